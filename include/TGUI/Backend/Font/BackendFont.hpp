@@ -32,6 +32,8 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
+    #include <utility>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +132,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// The result is the same as getGlyph(codePoint, characterSize, bold).advance, but backends can return it without
+        /// rendering the glyph. Use this function when measuring text.
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Reference character size
+        /// @param bold           Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual float getAdvance(char32_t codePoint, unsigned int characterSize, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -146,6 +164,37 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the width of multiple strings at once
+        ///
+        /// Each string is measured the same way as Text::getLineWidth: measuring stops at the first newline character,
+        /// carriage returns are ignored and a tab is 4 times as wide as a space.
+        /// Measuring many strings with a single call is faster than measuring them one by one.
+        ///
+        /// @param runs           Pointer to the strings to measure
+        /// @param runCount       Amount of strings in the runs array
+        /// @param characterSize  Size of the characters
+        /// @param bold           Measure the bold version of the glyphs or the regular one?
+        /// @param widths         Pointer to an array with runCount elements that will receive the widths of the strings
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs before they are needed, so that they don't have to be rendered while drawing the first frame
+        ///
+        /// @param codePointRanges  Inclusive ranges of unicode code points to load. Characters missing in the font are skipped.
+        /// @param characterSizes   Character sizes at which the glyphs will be used
+        /// @param styles           Text styles with which the glyphs will be used (only the bold style affects glyphs)
+        ///
+        /// The default implementation simply requests each glyph with getGlyph.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges, const std::vector<unsigned int>& characterSizes,
+                             const std::vector<TextStyles>& styles);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -216,6 +265,18 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize, unsigned int& textureVersion) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture version without updating or creating the texture
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param textureVersion Counter that is incremented each time the texture coordinates of existing glyphs change
+        ///
+        /// @return True if the version was returned, false if the font can only determine it by calling getTexture
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool getTextureVersion(unsigned int characterSize, unsigned int& textureVersion) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the texture that is used to store glyphs of the given character size
         ///
@@ -225,6 +286,36 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2u getTextureSize(unsigned int characterSize) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture that is used to store the glyphs of a given page
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param page           Index of the texture, as found in the page member of the glyphs
+        /// @param textureVersion Counter that is incremented each time the texture is changed, returned by this function
+        ///
+        /// @return Texture to render text glyphs with
+        ///
+        /// Fonts that store all glyphs of a character size in a single texture only have page 0. The default implementation
+        /// of this function simply calls getTexture.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getPageTexture(unsigned int characterSize, unsigned int page, unsigned int& textureVersion);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the texture that is used to store the glyphs of a given page
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param page           Index of the texture, as found in the page member of the glyphs
+        ///
+        /// @return Size of the texture that holds the glyphs
+        ///
+        /// The default implementation of this function simply calls getTextureSize.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Vector2u getPageTextureSize(unsigned int characterSize, unsigned int page);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -262,6 +353,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD float getFontScale() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a counter that changes each time a font is loaded or the font scale changes
+        ///
+        /// Measurements of text that were cached for this font are no longer valid when the returned value changes.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMetricsVersion() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -284,6 +385,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         bool m_isSmooth = true;
         float m_fontScale = 1;
+        unsigned int m_metricsVersion = 0; // Should be incremented by loadFromMemory in derived classes
     };
 }
 
@@ -32,6 +32,10 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
+    #include <vector>
+    #include <array>
+    #include <memory>
+    #include <utility>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +57,11 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendFontFreetype();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Destructor that cleans up the FreeType resources
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +102,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// The glyph is loaded to determine its metrics, but it isn't rendered and it isn't added to the font texture.
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Reference character size
+        /// @param bold           Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getAdvance(char32_t codePoint, unsigned int characterSize, bool bold) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -109,6 +133,122 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the width of multiple strings at once
+        ///
+        /// Each string is measured the same way as Text::getLineWidth: measuring stops at the first newline character,
+        /// carriage returns are ignored and a tab is 4 times as wide as a space.
+        ///
+        /// @param runs           Pointer to the strings to measure
+        /// @param runCount       Amount of strings in the runs array
+        /// @param characterSize  Size of the characters
+        /// @param bold           Measure the bold version of the glyphs or the regular one?
+        /// @param widths         Pointer to an array with runCount elements that will receive the widths of the strings
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields instead of as coverage bitmaps
+        ///
+        /// @param enabled  Should each glyph be rasterized only once, at a reference size, and be reused for all character sizes?
+        ///
+        /// In distance field mode the atlas contains the distance to the outline of each glyph instead of its coverage.
+        /// The same glyph is then used for every character size and font scale, so texts that change size or are zoomed don't
+        /// need new glyphs to be rendered. Small texts will however look less sharp than with the hinted glyphs that are used
+        /// by default. The distance fields have to be decoded by the renderer, which is only done by the OpenGL3 and GLES2 backends.
+        /// Changing this setting removes all glyphs from the atlas.
+        /// This function has no effect if the FreeType version is older than 2.11, which is the first version that supports it.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields instead of as coverage bitmaps
+        ///
+        /// @return Is the distance field mode enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether prewarm renders the glyphs on a background thread
+        ///
+        /// @param enabled  Should glyphs that are requested with prewarm be rendered by a worker thread?
+        ///
+        /// When enabled, prewarm returns immediately and a worker thread renders the glyphs with its own FreeType face.
+        /// The rendered glyphs are added to the atlas by commitPrewarmedGlyphs, which is also called automatically when a glyph
+        /// is requested that isn't in the atlas yet. Glyphs that are needed before the worker rendered them are still rendered
+        /// immediately. Background rendering is disabled by default.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBackgroundRasterizationEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether prewarm renders the glyphs on a background thread
+        ///
+        /// @return Is background rasterization enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBackgroundRasterizationEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs before they are needed, so that they don't have to be rendered while drawing the first frame
+        ///
+        /// @param codePointRanges  Inclusive ranges of unicode code points to load. Characters missing in the font are skipped.
+        /// @param characterSizes   Character sizes at which the glyphs will be used
+        /// @param styles           Text styles with which the glyphs will be used (only the bold style affects glyphs)
+        ///
+        /// The glyphs are rendered on a background thread if setBackgroundRasterizationEnabled was called.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges, const std::vector<unsigned int>& characterSizes,
+                     const std::vector<TextStyles>& styles) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the glyphs that were rendered in the background to the atlas
+        ///
+        /// This function is called automatically when a glyph is requested that isn't in the atlas yet. You can call it
+        /// yourself between frames to add the glyphs before they are needed.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void commitPrewarmedGlyphs();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the glyph atlas and the cached glyph metrics to a file, so that they can be reused at the next startup
+        ///
+        /// @param filename  Path of the cache file to write
+        ///
+        /// @return True if the file was written, false if no font was loaded or the file couldn't be written
+        ///
+        /// The file contains a hash of the font, so a cache file can't accidentally be loaded by a different font.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveGlyphCache(const String& filename);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyph atlas and glyph metrics from a file that was created with saveGlyphCache
+        ///
+        /// @param filename  Path of the cache file to read
+        ///
+        /// @return True if the glyphs were loaded. False if the file doesn't exist, is invalid, was created by a different TGUI
+        ///         version or for a different font, or if it doesn't match the current distance field mode or font scale.
+        ///
+        /// The font must already have been loaded. All glyphs that were loaded before are replaced by the ones from the file.
+        /// If loading fails then the font remains unchanged.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadGlyphCache(const String& filename);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -170,17 +310,31 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD float getUnderlineThickness(unsigned int characterSize) override;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Returns the texture that is used to store glyphs of the given character size
+        /// @brief Returns the texture of the first page, which contains glyphs of any character size
         ///
         /// @param characterSize  Size of the characters that should be part of the texture
-        /// @param textureVersion Counter that is incremented each time the texture is changed, returned by this function
+        /// @param textureVersion Counter that is incremented each time the texture coordinates of glyphs change, returned by this function
         ///
         /// @return Texture to render text glyphs with
+        ///
+        /// The texture version doesn't change when new glyphs are added to a page, only when existing glyphs are moved.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize, unsigned int& textureVersion) override;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Returns the size of the texture that is used to store glyphs of the given character size
+        /// @brief Returns the texture version without updating or creating the texture
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param textureVersion Counter that is incremented each time the texture coordinates of existing glyphs change
+        ///
+        /// @return Always true
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getTextureVersion(unsigned int characterSize, unsigned int& textureVersion) const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the texture of the first page
         ///
         /// @param characterSize  Size of the characters that should be part of the texture
         ///
@@ -188,6 +342,72 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2u getTextureSize(unsigned int characterSize) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture that is used to store the glyphs of a given page
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param page           Index of the texture, as found in the page member of the glyphs
+        /// @param textureVersion Counter that is incremented each time the texture coordinates of glyphs change, returned by this function
+        ///
+        /// @return Texture to render text glyphs with
+        ///
+        /// The first page starts small and grows when needed. Once it reached the maximum page size, new glyphs are placed
+        /// on additional pages with a fixed size, so that existing glyphs never have to be copied again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getPageTexture(unsigned int characterSize, unsigned int page, unsigned int& textureVersion) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the texture that is used to store the glyphs of a given page
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param page           Index of the texture, as found in the page member of the glyphs
+        ///
+        /// @return Size of the texture that holds the glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u getPageTextureSize(unsigned int characterSize, unsigned int page) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are used to store the glyphs
+        ///
+        /// @return Number of pages in the glyph atlas
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPageCount() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum amount of memory that the pages of the glyph atlas may use
+        ///
+        /// @param bytes  Memory limit in bytes, or 0 to never remove glyphs from the atlas
+        ///
+        /// When a new page would exceed the limit, the page that wasn't used for the longest time is cleared and reused instead.
+        /// Glyphs that were stored on that page will be rendered again when they are needed. The limit is only approximate:
+        /// at least one page is always kept, and glyphs that are too large for a page of the maximum size can exceed it.
+        /// While a limit is set, the measurements of character sizes that weren't used for a long time are forgotten as well.
+        /// The default limit is 64 MB.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAtlasMemoryLimit(std::size_t bytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory that the pages of the glyph atlas may use
+        ///
+        /// @return Memory limit in bytes, or 0 if glyphs are never removed from the atlas
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasMemoryLimit() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that is currently used by the pages of the glyph atlas
+        ///
+        /// @return Size of the pixels of all pages, in bytes
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasMemoryUsage() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -211,6 +431,15 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Pixel size at which glyphs are rendered when they are stored as distance fields, independent of the character size
+        static constexpr unsigned int DistanceFieldReferenceSize = 48;
+
+        // Distance in pixels (at the reference size) from the outline at which a distance field reaches its minimum or maximum
+        static constexpr unsigned int DistanceFieldSpread = 8;
+
+        // Amount of metrics tables that are kept when the atlas has a memory limit, each table is for a different character size and style
+        static constexpr std::size_t MaxMetricsTables = 32;
+
         struct Glyph
         {
             float     advance = 0;   //!< Offset to move horizontally to the next character
@@ -218,6 +447,59 @@ TGUI_MODULE_EXPORT namespace tgui
             float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
             FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            unsigned int page = 0;   //!< Index of the page that contains the glyph
+        };
+
+        // Metrics of a glyph that are needed to measure text, which can be retrieved without rendering the glyph
+        struct GlyphMetrics
+        {
+            float advance = 0;  //!< Offset to move horizontally to the next character, already divided by the font scale
+            float lsbDelta = 0; //!< Left offset after forced autohint
+            float rsbDelta = 0; //!< Right offset after forced autohint
+            bool  loaded = false;
+        };
+
+        // Metrics of all glyphs that were measured with a certain character size and style.
+        // Latin-1 characters are stored in arrays that are indexed by code point, other characters use hash maps.
+        struct MetricsTable
+        {
+            std::array<GlyphMetrics, 256> latinGlyphs;
+            std::unordered_map<char32_t, GlyphMetrics> otherGlyphs;
+            std::vector<float> asciiKerning; //!< 128x128 kerning pairs, allocated when first needed (NaN for pairs not yet calculated)
+            std::unordered_map<std::uint64_t, float> otherKerning;
+            std::uint64_t lastUsed = 0;      //!< Value of m_glyphUseCounter when the table was last selected
+        };
+
+        // Glyph that was rendered by rasterizeGlyph but that wasn't placed on a page yet
+        struct RasterizedGlyph
+        {
+            Glyph glyph;                     //!< Metrics of the glyph, the texture rect is only filled in by placeGlyph
+            unsigned int width = 0;          //!< Width of the bitmap
+            unsigned int height = 0;         //!< Height of the bitmap
+            std::vector<std::uint8_t> alpha; //!< Alpha value of each pixel in the bitmap, row by row
+            bool distanceField = false;      //!< Does the bitmap contain a distance field with a margin as wide as the spread?
+        };
+
+        // Worker thread that renders glyphs for prewarm, only created when background rasterization is used
+        struct PrewarmWorker;
+
+        // Horizontal segment of the skyline, which is the bottom edge of the area that is already occupied on a page
+        struct SkylineNode
+        {
+            unsigned int x;     //!< Left position of the segment
+            unsigned int y;     //!< Height of the occupied area above the segment
+            unsigned int width; //!< Width of the segment
+        };
+
+        struct Page
+        {
+            std::unique_ptr<std::uint8_t[]> pixels;
+            std::shared_ptr<BackendTexture> texture; //!< Created when needed, reset when the page grows or is cleared
+            unsigned int size = 0;
+            unsigned int dirtyRowsBegin = 0; //!< First row of pixels that changed since the texture was updated
+            unsigned int dirtyRowsEnd = 0;   //!< Row after the last row of pixels that changed since the texture was updated
+            std::vector<SkylineNode> skyline;
+            std::uint64_t lastUsed = 0;      //!< Value of m_glyphUseCounter when a glyph on this page was last requested
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,21 +507,107 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Renders a glyph to a bitmap with the given face. Doesn't access any members, so it can be called from the prewarm worker.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint, unsigned int pixelSize,
+                                   float pixelsPerUnit, bool distanceField, bool bold, float outlineThickness, RasterizedGlyph& result);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies a rendered glyph to one of the pages and returns the glyph with its texture rect
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph placeGlyph(const RasterizedGlyph& rasterizedGlyph);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the key under which a glyph is stored in m_glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Returns the metrics table for the given character size and style, creating it when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD MetricsTable& getMetricsTable(unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the metrics of a glyph from the table, loading them from the font if they weren't cached yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const GlyphMetrics& getGlyphMetrics(MetricsTable& table, char32_t codePoint, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the metrics of a glyph without rendering it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD GlyphMetrics loadGlyphMetrics(char32_t codePoint, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the kerning between two glyphs, without using the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float calculateKerning(MetricsTable& table, char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in one of the pages to place the glyph
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tries to place a rectangle on a page using the skyline bottom-left heuristic. Returns false if it didn't fit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool findPositionOnPage(const Page& page, unsigned int width, unsigned int height, std::size_t& nodeIndex, Vector2u& position);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether no glyphs were placed on the page yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isPageEmpty(const Page& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks a rectangle on a page as occupied, after its position was determined by findPositionOnPage
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void reservePageArea(Page& page, std::size_t nodeIndex, Vector2u position, unsigned int width, unsigned int height);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a new empty page to the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addPage(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all glyphs from a page so that its space can be reused
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearPage(unsigned int pageIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Doubles the size of a page, existing glyphs remain in the top left quadrant
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void growPage(Page& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size of the texture which a page can no longer grow beyond
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        TGUI_NODISCARD unsigned int getMaximumPageSize() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Sets the character size on which the freetype operations are performed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool setCurrentSize(unsigned int characterSize);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the size in pixels of the face, without taking the font scale into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool setPixelSize(FT_Face face, unsigned int pixelSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the prewarm worker with its own FreeType face if it didn't exist yet. Returns false if that failed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool startPrewarmWorker();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops the prewarm worker and destroys its FreeType resources. Glyphs that weren't committed yet are lost.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopPrewarmWorker();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Destroys freetype resources
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,32 +616,31 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        struct Row
-        {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
-
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
-        };
-
         FT_Library  m_library = nullptr;  // Handle to the freetype library
         FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
         FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
 
+        bool m_distanceFieldEnabled = false; // Are glyphs rendered as distance fields at DistanceFieldReferenceSize?
+
         std::unordered_map<unsigned int, float> m_cachedLineSpacing;
         std::unordered_map<unsigned int, float> m_cachedFontHeights;
         std::unordered_map<unsigned int, float> m_cachedAscents;
         std::unordered_map<unsigned int, float> m_cachedDescents;
 
         std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::unordered_map<std::uint32_t, MetricsTable> m_metricsTables; // Key contains the scaled character size and bold style
+        MetricsTable* m_lastMetricsTable = nullptr;  // Avoids the hash lookup when the same table is used repeatedly
+        std::uint32_t m_lastMetricsTableKey = 0;
+        std::vector<Page> m_pages;
+        std::uint64_t m_glyphUseCounter = 0;
+        std::size_t m_atlasMemoryLimit = 64 * 1024 * 1024;
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
+        std::size_t m_fileSize = 0;
+
+        std::unique_ptr<PrewarmWorker> m_prewarmWorker;
+        bool m_backgroundRasterizationEnabled = false;
+        unsigned int m_glyphGeneration = 0; // Changes when glyphs are rendered differently, to discard outdated prewarmed glyphs
         unsigned int m_textureVersion = 0;
     };
 
@@ -89,6 +89,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawGui(const std::shared_ptr<RootContainer>& root) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws part of the gui while keeping the rest of the contents from the previous frame
+        ///
+        /// @param root    Root container that holds all widgets in the gui
+        /// @param region  Part of the view that has to be redrawn (may be empty if nothing changed)
+        ///
+        /// This function is called instead of drawGui when damage tracking is enabled in the gui.
+        /// The default implementation ignores the region and redraws everything by calling drawGui.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a widget, if the widget is visible
         ///
@@ -230,6 +243,39 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                                      const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redirects all following draw calls to a texture until endRenderToTexture is called
+        ///
+        /// @param texture  Texture to render to. It is created or replaced when it is a nullptr or doesn't have the correct size.
+        /// @param size     Size of the area that will be drawn, the top left corner of the area is located at position (0,0)
+        ///
+        /// @return True when rendering to the texture has started, false if the render target doesn't support this
+        ///
+        /// The texture has the same amount of pixels per point as the render target had when this function was called.
+        /// The texture should only be drawn with drawRenderedTexture, as its contents may be stored in a backend-specific way.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool beginRenderToTexture(std::shared_ptr<BackendTexture>& texture, Vector2f size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops rendering to the texture that was passed to beginRenderToTexture
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void endRenderToTexture();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was rendered to with beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was rendered to
+        /// @param size     Size that was passed to beginRenderToTexture
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawRenderedTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture, Vector2f size);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the current mapping between the screen pixels and the points in the current view
         ///
@@ -244,9 +290,63 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2f getPixelsPerPoint() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area in which anything that is drawn will be visible
+        ///
+        /// @return Current clipping area in view coordinates, or the view itself when no clipping layer was added
+        ///
+        /// Widgets that lie completely outside this area don't have to be drawn.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getClipRect() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw calls are collected and reordered before being executed
+        ///
+        /// @param enabled  Should draw calls within the same clipping area be reordered to minimize texture changes?
+        ///
+        /// When enabled, the vertex arrays that are drawn inside the same clipping area are recorded instead of being drawn
+        /// immediately. Once the clipping changes or the gui is fully drawn, the recorded draw calls are sorted by texture so
+        /// that the render target can combine them into fewer draw calls. Draw calls that overlap are never reordered relative
+        /// to each other, so the result looks identical to drawing everything in the original order.
+        ///
+        /// This option is disabled by default and only has an effect on render targets that support it (OpenGL3 and GLES2).
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawCallReorderingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls are collected and reordered before being executed
+        ///
+        /// @return Is draw call reordering enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDrawCallReorderingEnabled() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a draw call when draw call reordering is enabled
+        ///
+        /// @return True if the draw call was recorded, false if the caller has to draw the vertices immediately
+        ///
+        /// Render targets that support reordering call this function at the start of their drawVertexArray function.
+        /// The recorded draw calls are executed again via drawVertexArray when flushDeferredDrawCalls is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool deferDrawCall(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                           const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes all draw calls that were recorded with deferDrawCall, sorted by texture where possible
+        ///
+        /// This is called automatically when the clipping changes. Render targets need to call it at the end of drawGui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushDeferredDrawCalls();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -266,6 +366,25 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        struct DeferredDrawCall
+        {
+            std::shared_ptr<BackendTexture> texture;
+            FloatRect bounds;
+            std::size_t firstVertex = 0;
+            std::size_t vertexCount = 0;
+            std::size_t firstIndex = 0;
+            std::size_t indexCount = 0; // 0 when the vertices were drawn without indices
+            std::size_t textureOrder = 0;
+            std::size_t layer = 0;
+        };
+
+        bool m_drawCallReorderingEnabled = false;
+        bool m_executingDeferredDrawCalls = false;
+        std::vector<DeferredDrawCall> m_deferredDrawCalls;
+        std::vector<Vertex> m_deferredVertices;
+        std::vector<unsigned int> m_deferredIndices;
+        std::vector<std::size_t> m_deferredDrawOrder;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,9 +164,60 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD TextVertexData getVertexData(bool includeOutline = true, bool includeText = true);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of memory used by the glyph run cache
+        ///
+        /// @param bytes  Approximate memory limit in bytes, or 0 to disable the cache
+        ///
+        /// Texts that have the same string, font, character size, style and colors share their vertices via a global cache.
+        /// Only short strings are cached and only when the font supports getTextureVersion. When the cache uses more memory
+        /// than this limit, the runs that weren't used for the longest time are removed from it. The default limit is 4 MB.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setGlyphRunCacheMemoryLimit(std::size_t bytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory used by the glyph run cache
+        ///
+        /// @return Approximate memory limit in bytes, or 0 if the cache is disabled
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getGlyphRunCacheMemoryLimit();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all runs from the glyph run cache
+        ///
+        /// Texts that are currently using vertices from the cache keep them until they need to update their vertices.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearGlyphRunCache();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called after changing a color. Returns true if the vertices were replaced by cached ones that already have the new colors.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadRecoloredVerticesFromGlyphRunCache();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the vertices if they are shared with the glyph run cache, so that they can be modified
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachSharedVertices();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the vertices with the ones from the glyph run cache. Returns false if the cache didn't contain them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadVerticesFromGlyphRunCache(unsigned int textureVersion);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the current vertices to the glyph run cache so that other texts can use them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void storeVerticesInGlyphRunCache(unsigned int textureVersion);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recreates all vertices if required
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,9 +249,10 @@ TGUI_MODULE_EXPORT namespace tgui
         TextStyles m_style = TextStyle::Regular;
 
         Vector2f m_size;
-        std::shared_ptr<std::vector<Vertex>> m_vertices;
-        std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_vertices; // Vertices for each page of the font texture
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_outlineVertices; // Outline vertices for each page of the font texture
         bool m_verticesNeedUpdate = true;
+        bool m_verticesShared = false; // Are the vertices also stored in the glyph run cache?
     };
 }
 
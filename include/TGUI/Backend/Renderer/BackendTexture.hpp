@@ -79,6 +79,20 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in part of the texture, without having to upload the entire image again
+        ///
+        /// @param region  Part of the texture to update, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture didn't exist yet or couldn't be updated
+        ///
+        /// If the pixels were stored by calling the load function, they will be updated as well.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateRegion(UIntRect region, const std::uint8_t* pixels);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -99,6 +113,27 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isSmooth() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the alpha channel of the texture contains a signed distance field instead of a coverage value
+        ///
+        /// @param distanceField  True if the renderer should decode the alpha channel as a distance field
+        ///
+        /// This is set by fonts that store their glyphs as distance fields. Only renderers that support it (OpenGL3 and GLES2)
+        /// take this property into account.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceField(bool distanceField);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the alpha channel of the texture contains a signed distance field instead of a coverage value
+        ///
+        /// @return True if the alpha channel should be decoded as a distance field
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceField() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks if a certain pixel is transparent
         ///
@@ -121,6 +156,7 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         bool m_isSmooth = true;
+        bool m_isDistanceField = false;
     };
 }
 
@@ -81,6 +81,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void drawGui(const std::shared_ptr<RootContainer>& root) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws part of the gui while keeping the rest of the contents from the previous frame
+        ///
+        /// @param root    Root container that holds all widgets in the gui
+        /// @param region  Part of the view that has to be redrawn (may be empty if nothing changed)
+        ///
+        /// The gui is rendered to an offscreen framebuffer that is copied to the currently bound framebuffer afterwards.
+        /// This requires OpenGL ES 3.0, the entire gui is redrawn when only OpenGL ES 2.0 is available.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a vertex array. This is called by the other draw functions.
         ///
@@ -94,9 +105,21 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many bytes of vertex and index data were sent to the GPU during the last drawGui call
+        ///
+        /// @return Amount of bytes that were uploaded
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getUploadedByteCount() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Buffer that is written to sequentially, the memory is only reused once the GPU is done with the old contents
+        struct StreamBuffer;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -108,16 +131,25 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Calls glEnableVertexAttribArray and glVertexAttribPointer.
-        // Called only once when using a VAO (GLES 3.x), but on every draw when using GLES 2.0
+        // Calls glVertexAttribPointer to make the attributes point to the vertices that start at the given offset in the buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVertexAttribs(std::size_t offset);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the data to an unused part of the buffer that is bound to the target, and returns the offset where it was stored
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void setVertexAttribs();
+        std::size_t uploadToStreamBuffer(StreamBuffer& stream, unsigned int target, const void* data, std::size_t dataSize, std::size_t alignment);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Creates the vertex and index buffers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or resizes the offscreen framebuffer that holds the previous frame. Returns false if its contents was lost.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool prepareBackBuffer();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -125,17 +157,24 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int m_vertexArray = 0;
         unsigned int m_vertexBuffer = 0;
         unsigned int m_indexBuffer = 0;
-        std::size_t m_vertexBufferSize = 0;
-        std::size_t m_indexBufferSize = 0;
+        std::unique_ptr<StreamBuffer> m_vertexStreamBuffer;
+        std::unique_ptr<StreamBuffer> m_indexStreamBuffer;
+        std::size_t m_uploadedByteCount = 0;
 
         std::unique_ptr<BackendTextureGLES2> m_emptyTexture;
         std::shared_ptr<BackendTextureGLES2> m_currentTexture;
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldShaderUniformLocation = -1;
+        bool m_distanceFieldTextureBound = false; // Value of the distance field uniform in the shader
         unsigned int m_positionShaderLocation = 0;
         unsigned int m_colorShaderLocation = 1;
         unsigned int m_texCoordShaderLocation = 2;
+
+        unsigned int m_backBufferFrameBuffer = 0;
+        std::unique_ptr<BackendTextureGLES2> m_backBufferTexture;
+        Optional<FloatRect> m_redrawRegion;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
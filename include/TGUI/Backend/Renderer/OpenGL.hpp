@@ -76,6 +76,10 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <array>
+    #include <cstddef>
+    #include <cstring>
     #include <string>
 #endif
 
@@ -127,6 +131,141 @@ namespace tgui
         {
         }
 #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Buffer that is written to sequentially, the memory is only reused once the GPU is done with the old contents.
+        // The buffer is split in segments. A fence is placed when all data in a segment has been used by draw calls,
+        // and we wait for that fence before writing to the segment again after the buffer wrapped around.
+        // Without fences (GLES 2.0), or when waiting for one fails, the buffer is orphaned instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if TGUI_BUILD_AS_CXX_MODULE
+        TGUI_MODULE_EXPORT
+#endif
+        struct StreamBufferOpenGL
+        {
+            static constexpr std::size_t SegmentCount = 4;
+            static constexpr std::size_t MinSegmentSize = 256 * 1024;
+
+            // The GPU is normally done with a segment long before we need it again, so waiting for the fence shouldn't take
+            // long. If the fence still isn't signaled after all retries, we stop waiting and orphan the buffer.
+            static constexpr GLuint64 FenceWaitTimeout = 100000000; // 100ms
+            static constexpr unsigned int MaxFenceWaitRetries = 10;
+
+            std::size_t size = 0;
+            std::size_t offset = 0;
+            std::size_t segment = 0;
+            std::array<GLsync, SegmentCount> fences = {};
+
+            StreamBufferOpenGL() = default;
+            StreamBufferOpenGL(const StreamBufferOpenGL&) = delete;
+            StreamBufferOpenGL& operator=(const StreamBufferOpenGL&) = delete;
+
+            ~StreamBufferOpenGL()
+            {
+                deleteFences();
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Copies data to the buffer that is currently bound to the target and returns the offset at which it was stored.
+            // When syncSupported is false, neither fences nor glMapBufferRange are used.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD std::size_t upload(GLenum target, const void* data, std::size_t dataSize, std::size_t alignment, bool syncSupported)
+            {
+                // Make the buffer larger if the data doesn't fit in a single segment
+                const std::size_t alignedDataSize = dataSize + alignment;
+                if (alignedDataSize > size / SegmentCount)
+                {
+                    size = std::max({alignedDataSize, 2 * size / SegmentCount, MinSegmentSize}) * SegmentCount;
+                    orphan(target);
+                }
+
+                // Data never crosses the border between segments, we move to the next segment if it doesn't fit in the current one
+                const std::size_t segmentSize = size / SegmentCount;
+                std::size_t dataOffset = ((offset + alignment - 1) / alignment) * alignment;
+                if (dataOffset + dataSize > (segment + 1) * segmentSize)
+                {
+                    // All draw calls that use the current segment were already issued, so the fence will be signaled after they finish
+                    if (syncSupported)
+                        fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+                    segment = (segment + 1) % SegmentCount;
+                    if (syncSupported)
+                    {
+                        if (!waitForSegment())
+                            orphan(target);
+                    }
+                    else if (segment == 0)
+                    {
+                        // Without fences we can't know when the GPU is done with the data, so we orphan the buffer when it wraps around
+                        orphan(target);
+                    }
+
+                    dataOffset = segment * segmentSize;
+                }
+
+                // We guaranteed that the GPU doesn't use this part of the buffer, so the driver doesn't have to synchronize anything
+                void* mappedData = nullptr;
+                if (syncSupported)
+                {
+                    mappedData = glMapBufferRange(target, static_cast<GLintptr>(dataOffset), static_cast<GLsizeiptr>(dataSize),
+                                                  GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+                }
+
+                if (mappedData)
+                {
+                    std::memcpy(mappedData, data, dataSize);
+                    TGUI_GL_CHECK(glUnmapBuffer(target));
+                }
+                else
+                    TGUI_GL_CHECK(glBufferSubData(target, static_cast<GLintptr>(dataOffset), static_cast<GLsizeiptr>(dataSize), data));
+
+                offset = dataOffset + dataSize;
+                return dataOffset;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Waits until the GPU no longer uses the current segment. Returns false if the fence failed or wasn't signaled in time.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool waitForSegment()
+            {
+                GLsync& fence = fences[segment];
+                if (!fence)
+                    return true;
+
+                GLenum waitResult = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceWaitTimeout);
+                for (unsigned int i = 1; (i < MaxFenceWaitRetries) && (waitResult == GL_TIMEOUT_EXPIRED); ++i)
+                    waitResult = glClientWaitSync(fence, 0, FenceWaitTimeout);
+
+                TGUI_GL_CHECK(glDeleteSync(fence));
+                fence = nullptr;
+                return (waitResult == GL_ALREADY_SIGNALED) || (waitResult == GL_CONDITION_SATISFIED);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Gives the buffer new storage and starts writing at the beginning again. The driver keeps the old storage alive
+            // until the GPU no longer needs it, so the fences that belonged to it are no longer needed.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void orphan(GLenum target)
+            {
+                TGUI_GL_CHECK(glBufferData(target, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW));
+                deleteFences();
+                offset = 0;
+                segment = 0;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Deletes all fences, which has to happen while the OpenGL context is still active
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void deleteFences()
+            {
+                for (GLsync& fence : fences)
+                {
+                    if (fence)
+                        TGUI_GL_CHECK(glDeleteSync(fence));
+                    fence = nullptr;
+                }
+            }
+        };
     }
 }
 #endif
@@ -81,6 +81,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void drawGui(const std::shared_ptr<RootContainer>& root) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws part of the gui while keeping the rest of the contents from the previous frame
+        ///
+        /// @param root    Root container that holds all widgets in the gui
+        /// @param region  Part of the view that has to be redrawn (may be empty if nothing changed)
+        ///
+        /// The gui is rendered to an offscreen framebuffer that is copied to the currently bound framebuffer afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a vertex array. This is called by the other draw functions.
         ///
@@ -94,9 +104,126 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws borders inside a provided rectangle
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param borders  The size of the borders on each side
+        /// @param size     Size of the area to draw the borders in
+        /// @param color    Color of the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a colored rectangle
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param size    Size of the rectangle to draw
+        /// @param color   Fill color of the rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawFilledRect(const RenderStates& states, Vector2f size, Color color) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a sprite
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a rectangle with rounded corners
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Size of the rectangle (includes borders)
+        /// @param backgroundColor  Color to fill the rectangle with
+        /// @param radius           Radius of the rounded corners
+        /// @param borders          Size of the borders. Only borders.getLeft() is used, the borders on all sides have to be equal.
+        /// @param borderColor      Color of the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor, float radius,
+                                  const Borders& borders = {0}, const Color& borderColor = Color::Black) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redirects all following draw calls to a texture until endRenderToTexture is called
+        ///
+        /// @param texture  Texture to render to. It is created or replaced when it is a nullptr or doesn't have the correct size.
+        /// @param size     Size of the area that will be drawn, the top left corner of the area is located at position (0,0)
+        ///
+        /// @return True when rendering to the texture has started, false if the size was empty
+        ///
+        /// The contents of the texture is stored upside down and with premultiplied alpha.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool beginRenderToTexture(std::shared_ptr<BackendTexture>& texture, Vector2f size) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops rendering to the texture that was passed to beginRenderToTexture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endRenderToTexture() override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was rendered to with beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was rendered to
+        /// @param size     Size that was passed to beginRenderToTexture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderedTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture, Vector2f size) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive draw calls are merged into a single OpenGL draw call
+        ///
+        /// @param enabled  Should vertices be collected and only be send to the GPU when the texture or clipping changes?
+        ///
+        /// When batching is enabled (default), the vertices are transformed on the CPU and stored in a single buffer. Only when
+        /// a different texture is needed or the clipping area changes will the accumulated vertices be drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive draw calls are merged into a single OpenGL draw call
+        ///
+        /// @return Is batching enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether rectangles, borders and simple sprites are drawn as instances of a single quad
+        ///
+        /// @param enabled  Should a dedicated instanced pipeline be used to draw quads?
+        ///
+        /// When enabled (default), drawFilledRect, drawBorders, drawRoundedRectangle and sprites that aren't split in multiple parts
+        /// don't generate any triangles. Instead a single set of attributes is uploaded for each quad and the rounded corners and
+        /// borders are calculated in the shader. This has no effect when batching is disabled or when draw calls are reordered.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setQuadInstancingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether rectangles, borders and simple sprites are drawn as instances of a single quad
+        ///
+        /// @return Is quad instancing enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isQuadInstancingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many bytes of vertex, index and instance data were sent to the GPU during the last drawGui call
+        ///
+        /// @return Amount of bytes that were uploaded
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getUploadedByteCount() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Buffer that is written to sequentially, the memory is only reused once the GPU is done with the old contents
+        struct StreamBuffer;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -112,21 +239,125 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all vertices that were collected since the last flush
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture (or the empty texture when nullptr is passed) if it differs from the current one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or resizes the offscreen framebuffer that holds the previous frame. Returns false if its contents was lost.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool prepareBackBuffer();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the static quad and the instance buffer that are used to draw quads with the instanced pipeline
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createQuadBuffers();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Points the per-instance attributes to the instances that start at the given offset in the instance buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setQuadInstanceAttributes(std::size_t offset);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the data to an unused part of the buffer that is bound to the target, and returns the offset where it was stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t uploadToStreamBuffer(StreamBuffer& stream, unsigned int target, const void* data, std::size_t dataSize, std::size_t alignment);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether drawing quads with the instanced pipeline is currently possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool canDrawQuadInstances() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a quad to the batch of instances. The rect and borders are in the coordinate system of the transform.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addQuadInstance(const Transform& transform, FloatRect rect, FloatRect texRect, Vertex::Color color, const Borders& borders,
+                             Vertex::Color borderColor, float radius, const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all quad instances that were collected since the last flush
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushQuadInstances();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the blend function depending on whether we are rendering to a texture or to the screen
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyBlendFunc();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // State of the render target that has to be restored when rendering to a texture ends
+        struct RenderLayer
+        {
+            std::shared_ptr<BackendTextureOpenGL3> texture;
+            FloatRect viewRect;
+            FloatRect viewport;
+            Vector2f targetSize;
+            std::vector<std::pair<FloatRect, FloatRect>> clipLayers;
+            Vector2f pixelsPerPoint;
+            Transform projectionTransform;
+            std::array<int, 4> scissorRect;
+            std::array<int, 4> viewportGL;
+            int drawFrameBuffer = 0;
+            int readFrameBuffer = 0;
+        };
+
+        // Attributes of a single quad when using the instanced pipeline
+        struct QuadInstance
+        {
+            std::array<float, 4> rect;       // Left, top, width and height of the quad before transforming it
+            std::array<float, 4> texRect;    // Texture coordinates of the top left and bottom right corners
+            std::array<float, 3> transformX; // First row of the 2D transformation matrix
+            std::array<float, 3> transformY; // Second row of the 2D transformation matrix
+            std::array<float, 4> borders;    // Left, top, right and bottom border sizes
+            float radius;                    // Radius of the rounded corners, or 0 when the corners aren't rounded
+            Vertex::Color color;
+            Vertex::Color borderColor;
+        };
+
         unsigned int m_shaderProgram = 0;
         unsigned int m_vertexArray = 0;
         unsigned int m_vertexBuffer = 0;
         unsigned int m_indexBuffer = 0;
-        std::size_t m_vertexBufferSize = 0;
-        std::size_t m_indexBufferSize = 0;
+        std::unique_ptr<StreamBuffer> m_vertexStreamBuffer;
+        std::unique_ptr<StreamBuffer> m_indexStreamBuffer;
+        std::size_t m_uploadedByteCount = 0;
 
         std::unique_ptr<BackendTextureOpenGL3> m_emptyTexture;
         std::shared_ptr<BackendTextureOpenGL3> m_currentTexture;
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldShaderUniformLocation = -1;
+        bool m_distanceFieldTextureBound = false; // Value of the distance field uniform in the shader
+
+        bool m_batchingEnabled = true;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+        std::array<int, 4> m_scissorRect = {{0, 0, 0, 0}};
+
+        bool m_quadInstancingEnabled = true;
+        unsigned int m_quadShaderProgram = 0;
+        unsigned int m_quadVertexArray = 0;
+        unsigned int m_quadVertexBuffer = 0;
+        unsigned int m_quadInstanceBuffer = 0;
+        std::unique_ptr<StreamBuffer> m_quadInstanceStreamBuffer;
+        int m_quadProjectionMatrixShaderUniformLocation = 0;
+        std::vector<QuadInstance> m_quadInstances;
+
+        unsigned int m_backBufferFrameBuffer = 0;
+        std::unique_ptr<BackendTextureOpenGL3> m_backBufferTexture;
+        Optional<FloatRect> m_redrawRegion;
+
+        unsigned int m_renderLayerFrameBuffer = 0;
+        std::vector<RenderLayer> m_renderLayers;
     };
 }
 
@@ -61,6 +61,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in part of the texture, without having to upload the entire image again
+        ///
+        /// @param region  Part of the texture to update, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture didn't exist yet or couldn't be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRegion(UIntRect region, const std::uint8_t* pixels) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
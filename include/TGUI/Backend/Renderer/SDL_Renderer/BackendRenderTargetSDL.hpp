@@ -87,6 +87,27 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive draw calls are merged into a single SDL_RenderGeometry call
+        ///
+        /// @param enabled  Should vertices be collected and only be passed to SDL when the texture or clipping changes?
+        ///
+        /// When batching is enabled (default), the vertices are transformed and stored in a single array. Only when a different
+        /// texture is needed or the clipping area changes will the accumulated vertices be drawn.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive draw calls are merged into a single SDL_RenderGeometry call
+        ///
+        /// @return Is batching enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -100,11 +121,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all vertices that were collected since the last flush
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         SDL_Renderer* m_renderer = nullptr;
         Transform m_projectionTransform;
+
+        bool m_batchingEnabled = true;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<std::array<float, 4>> m_batchColors; // Only used with SDL 3, which requires colors to be stored as floats
+        std::vector<int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
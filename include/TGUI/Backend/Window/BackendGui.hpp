@@ -550,6 +550,93 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the event loop can wait before updateTime() has to be called again
+        ///
+        /// @return Time until the next timer expires or a widget needs an update (e.g. to animate or to blink the edit cursor),
+        ///         or an empty value if nothing will change until the next event occurs
+        ///
+        /// The mainLoop() function uses this to sleep until the next event or deadline instead of waking up periodically.
+        /// A zero duration is returned while a widget still has to be updated, e.g. when its updateTime function reported a
+        /// change during the last update, so that the event loop never waits for an event while a widget is animating.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the gui keeps track of which parts of the screen changed, so that only those parts are redrawn
+        ///
+        /// @param enabled  Should only the damaged region be redrawn?
+        ///
+        /// When enabled, widgets report the areas that they need to redraw and draw() only updates that part of the screen,
+        /// provided that the render target supports it (OpenGL3 and GLES2). The contents of the previous frame is kept in an
+        /// offscreen buffer, so the window should be cleared with the same color every frame (like mainLoop does).
+        /// The mainLoop function will also skip rendering a frame when nothing was damaged.
+        ///
+        /// Widgets report the changes made with their functions, their renderers, events and animations themselves. Only when
+        /// a widget changes in a way that it can't know about (e.g. when rendering directly into a canvas) do you need to call
+        /// invalidate() on the widget yourself.
+        ///
+        /// Damage tracking is disabled by default.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDamageTrackingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps track of which parts of the screen changed
+        ///
+        /// @return Is damage tracking enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDamageTrackingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the entire gui as damaged, so that everything is redrawn during the next draw call
+        ///
+        /// This also causes containers that have their render cache enabled to redraw their child widgets.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks part of the gui as damaged, so that it gets redrawn during the next draw call
+        ///
+        /// @param rect  Area that needs to be redrawn, in the coordinate system that is used by the widgets
+        ///
+        /// This function is called by widgets when their visuals change. It has no effect when damage tracking is disabled.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRect(FloatRect rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something needs to be redrawn
+        ///
+        /// @return True if part of the gui was damaged since the last draw call, or when damage tracking is disabled
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRedrawRequired() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area that will be redrawn during the next draw call
+        ///
+        /// @return Damaged region, or the entire view when damage tracking is disabled or the entire gui was invalidated
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getDamagedRegion() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many times invalidate() was called. Used by containers to know when their render cache is outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getInvalidationCount() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Converts the pixel coordinate to a position within the view
         /// @param pixel  coordinate on the window
@@ -676,6 +763,10 @@ TGUI_MODULE_EXPORT namespace tgui
         FloatRect m_lastView;
 
         bool m_drawUpdatesTime = true;
+        bool m_damageTrackingEnabled = false;
+        bool m_fullRedrawRequired = true;
+        FloatRect m_damagedRegion;
+        std::uint64_t m_invalidationCount = 0;
         bool m_tabKeyUsageEnabled = true;
         bool m_keyboardNavigationEnabled = false; // TGUI_NEXT: Enable by default?
 
@@ -112,6 +112,8 @@ TGUI_MODULE_EXPORT namespace tgui
         void sortWidgets(Function&& function)
         {
             std::sort(m_widgets.begin(), m_widgets.end(), std::forward<Function>(function));
+            m_spatialIndex.valid = false;
+            m_childDrawBounds.valid = false;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +368,57 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Widget::Ptr getWidgetAtPos(Vector2f pos, bool recursive) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are rendered to a texture that is reused until one of them changes
+        ///
+        /// @param enabled  Should the children only be redrawn when they change?
+        ///
+        /// When the render cache is enabled, the child widgets are drawn to an offscreen texture and each frame only that texture
+        /// is drawn to the screen. Changes to the children (e.g. moving, resizing or hovering them with the mouse) and triggered
+        /// signals or timers cause the texture to be redrawn. If you change a child widget outside of a signal handler in a way
+        /// that isn't detected, then you should call invalidate() on that widget.
+        ///
+        /// This is useful for containers with many widgets that rarely change. The option is ignored when the backend renderer
+        /// doesn't support rendering to textures (only the OpenGL3 renderer supports it).
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are rendered to a texture that is reused until one of them changes
+        ///
+        /// @return Is the render cache enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRenderCacheEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget that is located below the mouse
+        ///
+        /// @param enabled  Should the child widgets be stored in a grid to find the widget below the mouse?
+        ///
+        /// Without the spatial index, every mouse event checks the child widgets one by one until the one below the mouse is
+        /// found. When the index is enabled, the area that each child can react to (see Widget::getMouseHitArea) is stored in
+        /// a uniform grid, so that only the few widgets in the grid cell below the mouse have to be checked. The grid is
+        /// updated automatically when children are added, removed, moved, resized or reordered.
+        ///
+        /// This is useful for containers with many children (e.g. thousands of widgets in a Grid).
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget that is located below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSpatialIndexEnabled() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -528,6 +581,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns how long updateTime can wait before it has to be called again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container. You should not call this function yourself.
@@ -565,6 +624,35 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(BackendRenderTarget& target, RenderStates states) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the child widgets, or the texture that contains them when the render cache is enabled
+        ///
+        /// @param target  Render target to draw to
+        /// @param states  Current render states
+        /// @param area    Part of the container that is visible, in the coordinate system of the child widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidgets(BackendRenderTarget& target, RenderStates states, FloatRect area) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the transformation from the coordinate system of the child widgets to absolute positions
+        ///
+        /// @return Absolute transform of the container, combined with the offset of the child widgets
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Transform getChildWidgetsAbsoluteTransform() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the cached absolute transforms of the child widgets as outdated
+        ///
+        /// This is done automatically when the container moves or when its renderer changes. Containers that override
+        /// getChildWidgetsOffset or getChildWidgetsAbsoluteTransform have to call this function when the value that those
+        /// functions return changes for any other reason.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetsOffsetChanged();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,6 +680,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr updateWidgetBelowMouse(Vector2f mousePos);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when an event that is send to the widget is handled by the widget itself, or false when the widget is
+        // a container that passes the event on to one of its own children. Used to know which widget needs to be redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isEventHandledByWidgetItself(const Widget::Ptr& widget, bool mouseEvent);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -607,6 +701,48 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2f transformMousePos(const Widget::Ptr& widget, Vector2f mousePos) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the bounding box of an area of a child widget, taking its position, origin, rotation and scaling into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static FloatRect getChildBounds(const Widget& widget, FloatRect area);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the spatial index is up-to-date. Returns false if the index can't be used (e.g. because of infinite sizes).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateSpatialIndex() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the entire spatial index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a widget to or from all the spatial index cells that overlap with the given bounds
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSpatialIndexCells(std::size_t widgetIndex, FloatRect bounds, bool insert) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the cached bounds in which the child widgets are drawn are up-to-date.
+        // Returns false if the bounds can't be cached, in which case every child widget has to be passed to the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateChildDrawBounds() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds out whether the cached bounds of the child widgets are sorted by position, so that the visible range can be searched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChildDrawBoundsOrder() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by Widget::invalidateRect when a child widget changed. The render cache has to be redrawn and the bounds of
+        // the child in the spatial index may have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetInvalidated(Widget* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by Widget::requestTimeUpdates when updateTime has to be called on a child widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childRequestedTimeUpdates(Widget* widget);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Finishes adding a widget to the container
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,7 +774,45 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheValid = false;
+        mutable FloatRect m_renderCacheArea;
+        mutable Vector2f m_renderCachePixelsPerPoint;
+        mutable std::uint64_t m_renderCacheGuiInvalidationCount = 0;
+        mutable std::shared_ptr<BackendTexture> m_renderCacheTexture;
+
+        struct SpatialIndex
+        {
+            bool valid = false;
+            bool usable = false; // False when the bounds of the widgets can't be stored in a grid
+            FloatRect area; // Region covered by the grid, in the same coordinates as the positions of the child widgets
+            Vector2f cellSize;
+            std::size_t columns = 0;
+            std::size_t rows = 0;
+            std::vector<FloatRect> bounds; // Bounds of each widget in m_widgets
+            std::vector<std::vector<std::size_t>> cells; // Indices in m_widgets of widgets that overlap with each cell, sorted
+            std::vector<const Widget*> changedWidgets; // Widgets that were invalidated since the index was last updated
+        };
+
+        bool m_spatialIndexEnabled = false;
+        mutable SpatialIndex m_spatialIndex;
+
+        struct ChildDrawBounds
+        {
+            bool valid = false;
+            std::vector<FloatRect> bounds; // Area in which each widget in m_widgets is drawn, in the coordinates of the children
+            bool sorted = false; // Are the widgets placed from top to bottom (or left to right)?
+            bool sortedVertically = false; // Are the widgets sorted on their top or on their left side?
+            std::vector<float> maxEnds; // Largest bottom (or right) side of all widgets up to each index, when the widgets are sorted
+            std::vector<const Widget*> changedWidgets; // Widgets that were invalidated since the bounds were last updated
+        };
+
+        mutable ChildDrawBounds m_childDrawBounds;
+
+        std::vector<Widget::Ptr> m_timeDependentWidgets; // Child widgets on which updateTime still has to be called
+
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Widget::invalidateRect and requestTimeUpdates inform the parents about changes in the widget
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -27,12 +27,15 @@
 
 #include <TGUI/String.hpp>
 #include <TGUI/Rect.hpp>
+#include <TGUI/TextStyle.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
     #include <string>
     #include <cstddef>
     #include <memory>
+    #include <utility>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +52,7 @@ TGUI_MODULE_EXPORT namespace tgui
         float     advance = 0;  //!< Offset to move horizontally to the next character
         FloatRect bounds;       //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
         UIntRect  textureRect;  //!< Texture coordinates of the glyph inside the font's texture
+        unsigned int page = 0;  //!< Index of the font texture that contains the glyph (see BackendFont::getPageTexture)
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,6 +155,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// The result is the same as getGlyph(codePoint, characterSize, bold).advance, but the font backend can return it
+        /// without rendering the glyph. Use this function when measuring text.
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Reference character size
+        /// @param bold           Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getAdvance(char32_t codePoint, unsigned int characterSize, bool bold = false) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -167,6 +187,42 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold = false) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the width of multiple strings at once
+        ///
+        /// Each string is measured the same way as Text::getLineWidth: measuring stops at the first newline character,
+        /// carriage returns are ignored and a tab is 4 times as wide as a space.
+        /// Measuring many strings with a single call is faster than measuring them one by one.
+        ///
+        /// @param runs           Pointer to the strings to measure
+        /// @param runCount       Amount of strings in the runs array
+        /// @param characterSize  Size of the characters
+        /// @param bold           Measure the bold version of the glyphs or the regular one?
+        /// @param widths         Pointer to an array with runCount elements that will receive the widths of the strings
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs before they are needed, so that they don't have to be rendered while drawing the first frame
+        ///
+        /// @param codePointRanges  Inclusive ranges of unicode code points to load. Characters missing in the font are skipped.
+        /// @param characterSizes   Character sizes at which the glyphs will be used
+        /// @param styles           Text styles with which the glyphs will be used (only the bold style affects glyphs)
+        ///
+        /// @code
+        /// font.prewarm({{U' ', U'~'}, {U'\u00A0', U'\u00FF'}}, {13, 18}, {tgui::TextStyle::Regular, tgui::TextStyle::Bold});
+        /// @endcode
+        ///
+        /// Depending on the font backend, the glyphs may be rendered on a background thread
+        /// (see BackendFontFreetype::setBackgroundRasterizationEnabled).
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges, const std::vector<unsigned int>& characterSizes,
+                     const std::vector<TextStyles>& styles = {TextStyle::Regular}) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
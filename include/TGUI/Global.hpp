@@ -161,6 +161,19 @@ TGUI_MODULE_EXPORT namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API bool writeFile(const String& filename, CharStringView textToWrite);
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Opens a file and writes the given bytes to it, without converting line endings
+    ///
+    /// @param filename  Path to the file to write
+    /// @param data      Bytes to be written to the file
+    /// @param size      Amount of bytes to write
+    ///
+    /// @return True on success, false if opening or writing to the file failed
+    ///
+    /// @since TGUI 1.6
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool writeFile(const String& filename, const std::uint8_t* data, std::size_t size);
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -141,6 +141,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void leftMouseButtonNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getHoverStateId() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +165,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns how long updateTime can wait before it has to be called again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -205,6 +216,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(BackendRenderTarget& target, RenderStates states) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests time updates from our parent when one of the subwidgets needs them. The subwidgets can't inform our parent
+        // themselves, so this is called after passing on events that could e.g. focus an edit box or start a double click.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestTimeUpdatesForSubwidgets();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
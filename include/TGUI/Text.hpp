@@ -63,6 +63,19 @@ TGUI_MODULE_EXPORT namespace tgui
             Vector2u     gapSize;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Describes a single line of a word-wrapped string as a range within the original string
+        ///
+        /// The newline character that ended the line (if any) is not part of the range.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct LineSpan
+        {
+            std::size_t start;
+            std::size_t length;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a small distance that text should be placed from the side of a widget as padding.
         ///
@@ -116,6 +129,54 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static String wordWrap(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits a string into lines so that the width of each line does not exceed maxWidth
+        ///
+        /// This gives the same result as the wordWrap function that returns a string, but instead of copying the text and
+        /// inserting newlines, the lines are returned as ranges within the original string. Every character is measured once.
+        ///
+        /// @param maxWidth         Maximum width of the text, or 0 to only split the text on its newline characters
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        ///
+        /// @return Ranges of the lines within the text. This contains at least one element, unless the font is a nullptr.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<LineSpan> wordWrapSpans(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of memory used by the word-wrap cache
+        ///
+        /// @param bytes  Approximate memory limit in bytes, or 0 to disable the cache
+        ///
+        /// The wordWrap and wordWrapSpans functions store the line breaks of every paragraph (text between newlines) together
+        /// with the range of widths for which those breaks remain the same. When the same paragraph is wrapped again with a
+        /// width inside that range, it doesn't have to be measured again. When the cache uses more memory than this limit,
+        /// the paragraphs that weren't used for the longest time are removed from it. The default limit is 4 MB.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setWordWrapCacheMemoryLimit(std::size_t bytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory used by the word-wrap cache
+        ///
+        /// @return Approximate memory limit in bytes, or 0 if the cache is disabled
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getWordWrapCacheMemoryLimit();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all paragraphs from the word-wrap cache
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearWordWrapCache();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// Takes multiple lines of potentially multiple text pieces, and splits lines so that the width does not exceed maxWidth
         ///
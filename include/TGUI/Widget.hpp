@@ -34,6 +34,7 @@
 #include <TGUI/String.hpp>
 #include <TGUI/Vector2.hpp>
 #include <TGUI/Duration.hpp>
+#include <TGUI/Optional.hpp>
 #include <TGUI/Cursor.hpp>
 #include <TGUI/Event.hpp>
 #include <TGUI/Any.hpp>
@@ -286,6 +287,39 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2f getAbsolutePosition(Vector2f offset = {}) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the transformation that places the widget inside its parent
+        ///
+        /// @return Transform that maps points relative to the top-left of the widget to points relative to the parent
+        ///
+        /// The transform combines the position, origin, rotation and scale of the widget. It is cached and only recalculated
+        /// after one of these properties (or the size of the widget) changed.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Transform& getTransform() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the transformation from points inside the widget to absolute positions
+        ///
+        /// @return Transform that maps points relative to the top-left of the widget to absolute positions
+        ///
+        /// getAbsolutePosition(offset) is the same as getAbsoluteTransform().transformPoint(offset).
+        /// The transform is cached, it is only recalculated after the widget or one of its parents was changed.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Transform& getAbsoluteTransform() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bounding box of the widget in absolute coordinates
+        ///
+        /// @return Smallest rectangle that contains the full size of the widget, in absolute coordinates
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getAbsoluteBounds() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the distance between the position where the widget is drawn and where the widget is placed
         ///
@@ -629,6 +663,18 @@ TGUI_MODULE_EXPORT namespace tgui
             return m_parentGui;
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget has to be redrawn
+        ///
+        /// This function only has an effect when damage tracking is enabled in the gui. Changes made with the functions of the
+        /// widget, its renderer or by events are reported automatically. This function only needs to be called after a change
+        /// that the widget can't know about, e.g. after rendering directly into a canvas or changing the state of a custom widget.
+        ///
+        /// @see BackendGui::setDamageTrackingEnabled
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether there is an active animation (started with showWithEffect or hideWithEffect)
         ///
@@ -959,6 +1005,20 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool updateTime(Duration elapsedTime);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long updateTime can wait before it has to be called again
+        ///
+        /// @return Time until the next update, or an empty value if the widget has nothing pending that depends on time
+        ///
+        /// The parent only calls updateTime on widgets that need it, and mainLoop uses this value to sleep until the next deadline.
+        /// A custom widget that changes over time should override this function, and call requestTimeUpdates when something
+        /// starts that depends on time (e.g. from an event handler). Widgets without this function are still updated once
+        /// after being added or shown, and again for as long as their updateTime function keeps returning true.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Optional<Duration> getTimeUntilNextUpdate() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called at the start and end of a layout update to temporarily disable AutoLayout callbacks during the update
@@ -1052,6 +1112,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rightMouseButtonNoLongerDown();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns a value that changes whenever the part of the widget below the mouse changes in a way that affects how the
+        // widget looks. This is used to avoid redrawing the widget on every mouse move when damage tracking is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::size_t getHoverStateId() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Show the tool tip when the widget is located below the mouse.
@@ -1158,6 +1225,47 @@ TGUI_MODULE_EXPORT namespace tgui
         using SavingRenderersMap = std::map<const Widget*, std::pair<std::unique_ptr<DataIO::Node>, String>>;
         using LoadingRenderersMap = std::map<String, std::shared_ptr<RendererData>>;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Informs the gui that part of the widget has to be redrawn. The rect is relative to the top-left of the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRect(FloatRect rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached transform as outdated, called when the position, size, origin, rotation or scale of the widget changes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void transformChanged();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute transform of the widget, and of all widgets inside it, as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void absoluteTransformChanged();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes sure that updateTime gets called on the widget, e.g. when an animation starts or a double click becomes possible
+        ///
+        /// The parent stops updating the widget again once getTimeUntilNextUpdate no longer returns a value and updateTime
+        /// returned false.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestTimeUpdates();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Helper for getTimeUntilNextUpdate. Returns the earliest of the given duration and the time left until elapsedTime reaches
+        // the deadline (zero if it already passed). The duration is returned unchanged when no deadline is given.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Optional<Duration> combineTimeUntilNextUpdate(Optional<Duration> duration, Duration elapsedTime, const Optional<Duration>& deadline);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area in which isMouseOnWidget can return true, relative to the top-left position of the widget
+        ///
+        /// This area is used by the spatial index of the parent (see Container::setSpatialIndexEnabled).
+        /// The default implementation returns the full size of the widget, starting at the widget offset.
+        ///
+        /// @since TGUI 1.6
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual FloatRect getMouseHitArea() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -1242,6 +1350,13 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
+        // Transforms that are cached until the widget changes. When the absolute transform of a widget is valid, then the
+        // absolute transforms of all its parents are valid as well, so they only need to be marked as outdated top-down.
+        mutable Transform m_transform;
+        mutable Transform m_absoluteTransform;
+        mutable bool m_transformValid = false;
+        mutable bool m_absoluteTransformValid = false;
+
         // Layouts that need to recalculate their value when the position or size of this widget changes
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
@@ -478,6 +478,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long updateTime can wait before it has to be called again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,6 +446,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long updateTime can wait before it has to be called again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -565,6 +570,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::size_t m_selectedFileTypeFilter = 0;
 
         std::shared_ptr<FileDialogIconLoader> m_iconLoader;
+        bool m_fileIconsRequested = false;
 
         std::vector<Filesystem::Path> m_selectedFiles;
     };
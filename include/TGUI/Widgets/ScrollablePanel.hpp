@@ -349,6 +349,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void leftMouseButtonNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getHoverStateId() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Shows the tool tip when the widget is located below the mouse.
@@ -375,6 +380,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rendererChanged(const String& property) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the transformation from the coordinate system of the child widgets to absolute positions
+        ///
+        /// @return Absolute transform of the panel, combined with the offset of the child widgets and the scroll offset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Transform getChildWidgetsAbsoluteTransform() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,6 +441,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void disconnectAllChildWidgets();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connect the value change events of the scrollbars, as scrolling changes the absolute positions of the child widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectScrollbarValueChange();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -133,6 +133,93 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFont::getAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        return getGlyph(codePoint, characterSize, bold).advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths)
+    {
+        for (std::size_t i = 0; i < runCount; ++i)
+        {
+            float width = 0;
+            char32_t prevChar = 0;
+            for (const char32_t curChar : runs[i])
+            {
+                if (curChar == U'\n')
+                    break;
+                else if (curChar == U'\r')
+                    continue;
+
+                float charWidth;
+                if (curChar == U'\t')
+                    charWidth = getAdvance(U' ', characterSize, bold) * 4;
+                else
+                    charWidth = getAdvance(curChar, characterSize, bold);
+
+                width += charWidth + getKerning(prevChar, curChar, characterSize, bold);
+                prevChar = curChar;
+            }
+
+            widths[i] = width;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges, const std::vector<unsigned int>& characterSizes,
+                              const std::vector<TextStyles>& styles)
+    {
+        for (const TextStyles style : styles)
+        {
+            const bool bold = (style & TextStyle::Bold) != 0;
+            for (const unsigned int characterSize : characterSizes)
+            {
+                for (const auto& range : codePointRanges)
+                {
+                    for (char32_t codePoint = range.first; codePoint <= range.second; ++codePoint)
+                    {
+                        if (hasGlyph(codePoint))
+                            (void)getGlyph(codePoint, characterSize, bold);
+
+                        // Prevent an infinite loop when the range ends at the largest possible code point
+                        if (codePoint == range.second)
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::getTextureVersion(unsigned int, unsigned int&) const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFont::getPageTexture(unsigned int characterSize, unsigned int page, unsigned int& textureVersion)
+    {
+        TGUI_ASSERT(page == 0, "BackendFont::getPageTexture can only be called with page 0 when it isn't overridden");
+        (void)page;
+        return getTexture(characterSize, textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFont::getPageTextureSize(unsigned int characterSize, unsigned int page)
+    {
+        TGUI_ASSERT(page == 0, "BackendFont::getPageTextureSize can only be called with page 0 when it isn't overridden");
+        (void)page;
+        return getTextureSize(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -153,6 +240,7 @@ namespace tgui
             return;
 
         m_fontScale = scale;
+        ++m_metricsVersion;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +251,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFont::getMetricsVersion() const
+    {
+        return m_metricsVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
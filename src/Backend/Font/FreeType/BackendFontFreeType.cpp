@@ -39,13 +39,31 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
 
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
 
+// Rendering glyphs as signed distance fields requires FreeType 2.11 or newer
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+    #define TGUI_FREETYPE_HAS_SDF 1
+#else
+    #define TGUI_FREETYPE_HAS_SDF 0
+#endif
+
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
     #include <cmath>
+    #include <condition_variable>
+    #include <cstring>
+    #include <deque>
+    #include <limits>
+    #include <mutex>
+    #include <thread>
+    #include <type_traits>
+    #include <unordered_set>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +74,149 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // The worker renders glyphs with its own FreeType face. The rendered bitmaps are staged until the font places them on its pages.
+    struct BackendFontFreetype::PrewarmWorker
+    {
+        struct Job
+        {
+            std::uint64_t glyphKey = 0;
+            char32_t codePoint = 0;
+            unsigned int pixelSize = 0;
+            float pixelsPerUnit = 1;
+            bool distanceField = false;
+            bool bold = false;
+            unsigned int generation = 0;
+        };
+
+        struct StagedGlyph
+        {
+            std::uint64_t glyphKey = 0;
+            unsigned int generation = 0;
+            RasterizedGlyph rasterizedGlyph;
+        };
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true)
+            {
+                condition.wait(lock, [this]{ return stopRequested || !jobs.empty(); });
+                if (stopRequested)
+                    return;
+
+                const Job job = jobs.front();
+                jobs.pop_front();
+
+                // Render the glyph without holding the lock, so that new jobs can be queued in the meantime
+                lock.unlock();
+                StagedGlyph stagedGlyph;
+                stagedGlyph.glyphKey = job.glyphKey;
+                stagedGlyph.generation = job.generation;
+                const bool rendered = rasterizeGlyph(library, face, stroker, job.codePoint, job.pixelSize, job.pixelsPerUnit,
+                                                     job.distanceField, job.bold, 0, stagedGlyph.rasterizedGlyph);
+                lock.lock();
+
+                // Glyphs that failed to render are skipped, they will be loaded on the main thread when needed
+                if (rendered)
+                {
+                    stagedGlyphs.push_back(std::move(stagedGlyph));
+                    hasStagedGlyphs = true;
+                }
+            }
+        }
+
+        FT_Library library = nullptr;
+        FT_Face face = nullptr;
+        FT_Stroker stroker = nullptr;
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<Job> jobs;
+        std::vector<StagedGlyph> stagedGlyphs;
+        std::atomic<bool> hasStagedGlyphs{false};
+        bool stopRequested = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Start of every glyph cache file. The version has to be increased each time the layout of the file changes.
+        constexpr std::array<char, 8> GlyphCacheMagic = {{'T', 'G', 'U', 'I', 'G', 'L', 'Y', 'C'}};
+        constexpr std::uint32_t GlyphCacheVersion = 2;
+
+        // Values are stored with the byte order of the machine, this value rejects files that were written with another one
+        constexpr std::uint32_t GlyphCacheByteOrderMark = 0x01020304;
+
+        // 64-bit FNV-1a hash of the font file, so that a cache file isn't used with a different font
+        TGUI_NODISCARD std::uint64_t hashFontData(const std::uint8_t* data, std::size_t size)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+
+        struct GlyphCacheWriter
+        {
+            template <typename T>
+            void write(const T& value)
+            {
+                static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+                writeBytes(reinterpret_cast<const std::uint8_t*>(&value), sizeof(T));
+            }
+
+            void writeBytes(const std::uint8_t* bytes, std::size_t count)
+            {
+                data.insert(data.end(), bytes, bytes + count);
+            }
+
+            std::vector<std::uint8_t> data;
+        };
+
+        // All reads check the remaining size, so that a truncated or corrupted file can't cause reads past the end of the data
+        struct GlyphCacheReader
+        {
+            template <typename T>
+            TGUI_NODISCARD bool read(T& value)
+            {
+                static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+                return readBytes(reinterpret_cast<std::uint8_t*>(&value), sizeof(T));
+            }
+
+            TGUI_NODISCARD bool readBytes(std::uint8_t* bytes, std::size_t count)
+            {
+                if (count > size - offset)
+                    return false;
+
+                std::memcpy(bytes, data + offset, count);
+                offset += count;
+                return true;
+            }
+
+            // Reads an element count and checks that the remaining data could contain that many elements
+            TGUI_NODISCARD bool readCount(std::uint64_t& count, std::size_t minElementSize)
+            {
+                return read(count) && (count <= (size - offset) / minElementSize);
+            }
+
+            const std::uint8_t* data = nullptr;
+            std::size_t size = 0;
+            std::size_t offset = 0;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::BackendFontFreetype() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::~BackendFontFreetype()
     {
         cleanup();
@@ -65,49 +226,34 @@ namespace tgui
 
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        ++m_metricsVersion;
         cleanup();
         m_cachedLineSpacing.clear();
         m_cachedFontHeights.clear();
         m_cachedAscents.clear();
         m_cachedDescents.clear();
         m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
+        m_metricsTables.clear();
+        m_lastMetricsTable = nullptr;
+        m_pages.clear();
+        ++m_textureVersion;
 
+        // The first page starts small, it will grow when more glyphs are added
         constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
-
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
-
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
-        {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
-        }
-
-        m_textureSize = initialTextureSize;
+        addPage(initialTextureSize);
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
         if (FT_Init_FreeType(&library) != 0)
             throw Exception{U"Failed to initialize Freetype"};
 
+#if TGUI_FREETYPE_HAS_SDF
+        // The default spread of distance fields is only 2 pixels, which isn't enough to scale glyphs up or to render outlines
+        FT_UInt spread = DistanceFieldSpread;
+        FT_Property_Set(library, "sdf", "spread", &spread);
+        FT_Property_Set(library, "bsdf", "spread", &spread);
+#endif
+
         // Load the font face from the font file that we have in memory
         FT_Face face;
         if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data.get()), static_cast<FT_Long>(sizeInBytes), 0, &face) != 0)
@@ -125,6 +271,7 @@ namespace tgui
         }
 
         m_fileContents = std::move(data);
+        m_fileSize = sizeInBytes;
         m_library = library;
         m_face = face;
         return true;
@@ -142,222 +289,828 @@ namespace tgui
     FontGlyph BackendFontFreetype::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         FontGlyph glyph;
-        if (!m_face)
+        if (!m_face || (m_distanceFieldEnabled && (characterSize == 0)))
             return glyph;
 
         const Glyph& internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
-        glyph.advance = internalGlyph.advance / m_fontScale;
-        glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
-        glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
+        if (m_distanceFieldEnabled)
+        {
+            // The glyph was rendered at the reference size and is scaled to the requested size. The advance is taken from
+            // the hinted metrics of the requested size instead, so that the text is laid out the same way as it is measured.
+            const float scale = static_cast<float>(characterSize) / DistanceFieldReferenceSize;
+            glyph.advance = getAdvance(codePoint, characterSize, bold);
+
+            glyph.bounds.setPosition(internalGlyph.bounds.getPosition() * scale);
+            glyph.bounds.setSize(internalGlyph.bounds.getSize() * scale);
+        }
+        else
+        {
+            glyph.advance = internalGlyph.advance / m_fontScale;
+            glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
+            glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
+        }
+
         glyph.textureRect = internalGlyph.textureRect;
+        glyph.page = internalGlyph.page;
         return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFontFreetype::getAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        if (!m_face)
+            return 0;
+
+        return getGlyphMetrics(getMetricsTable(characterSize, bold), codePoint, characterSize, bold).advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float BackendFontFreetype::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
     {
         // There is no kerning if one of the two characters is the null character
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_face)
             return 0;
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
-        const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
-
-        // Get the kerning vector if present
-        FT_Vector kerning;
-        kerning.x = kerning.y = 0;
-        if (FT_HAS_KERNING(m_face))
+        MetricsTable& table = getMetricsTable(characterSize, bold);
+        if ((first < 128) && (second < 128))
         {
-            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
-            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
-            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+            if (table.asciiKerning.empty())
+                table.asciiKerning.resize(128 * 128, std::numeric_limits<float>::quiet_NaN());
+
+            float& kerning = table.asciiKerning[(first * 128) + second];
+            if (std::isnan(kerning))
+                kerning = calculateKerning(table, first, second, characterSize, bold);
+
+            return kerning;
         }
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(m_face))
-            return static_cast<float>(kerning.x) / m_fontScale;
+        const std::uint64_t pairKey = (static_cast<std::uint64_t>(first) << 32) | static_cast<std::uint64_t>(second);
+        const auto it = table.otherKerning.find(pairKey);
+        if (it != table.otherKerning.end())
+            return it->second;
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / unitsPerPixel) / m_fontScale;
+        const float kerning = calculateKerning(table, first, second, characterSize, bold);
+        table.otherKerning[pairKey] = kerning;
+        return kerning;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getLineSpacing(unsigned int characterSize)
+    void BackendFontFreetype::measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+        if (!m_face)
+        {
+            std::fill(widths, widths + runCount, 0.f);
+            return;
+        }
 
-        const auto it = m_cachedLineSpacing.find(scaledCharacterSize);
-        if (it != m_cachedLineSpacing.end())
-            return it->second / m_fontScale;
+        // The table lookup and the character size only have to be set once for all strings
+        MetricsTable& table = getMetricsTable(characterSize, bold);
+        if (table.asciiKerning.empty())
+            table.asciiKerning.resize(128 * 128, std::numeric_limits<float>::quiet_NaN());
 
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
+        const float tabWidth = getGlyphMetrics(table, U' ', characterSize, bold).advance * 4;
+        for (std::size_t i = 0; i < runCount; ++i)
+        {
+            float width = 0;
+            char32_t prevChar = 0;
+            for (const char32_t curChar : runs[i])
+            {
+                if (curChar == U'\n')
+                    break;
+                else if (curChar == U'\r')
+                    continue;
+
+                // Latin-1 advances and ASCII kerning pairs are read directly from the table once they have been cached
+                float charWidth;
+                if (curChar == U'\t')
+                    charWidth = tabWidth;
+                else if ((curChar < table.latinGlyphs.size()) && table.latinGlyphs[curChar].loaded)
+                    charWidth = table.latinGlyphs[curChar].advance;
+                else
+                    charWidth = getGlyphMetrics(table, curChar, characterSize, bold).advance;
+
+                float kerning = 0;
+                if ((prevChar != 0) && (prevChar < 128) && (curChar < 128))
+                {
+                    float& cachedKerning = table.asciiKerning[(prevChar * 128) + curChar];
+                    if (std::isnan(cachedKerning))
+                        cachedKerning = calculateKerning(table, prevChar, curChar, characterSize, bold);
 
-        const float lineSpacing = m_face->size->metrics.height / unitsPerPixel;
-        m_cachedLineSpacing[scaledCharacterSize] = lineSpacing;
-        return lineSpacing / m_fontScale;
+                    kerning = cachedKerning;
+                }
+                else if (prevChar != 0)
+                    kerning = BackendFontFreetype::getKerning(prevChar, curChar, characterSize, bold);
+
+                width += charWidth + kerning;
+                prevChar = curChar;
+            }
+
+            widths[i] = width;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getFontHeight(unsigned int characterSize)
+    void BackendFontFreetype::setDistanceFieldEnabled(bool enabled)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+#if TGUI_FREETYPE_HAS_SDF
+        if (m_distanceFieldEnabled == enabled)
+            return;
 
-        const auto it = m_cachedFontHeights.find(scaledCharacterSize);
-        if (it != m_cachedFontHeights.end())
-            return it->second / m_fontScale;
+        m_distanceFieldEnabled = enabled;
 
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
+        // Coverage bitmaps and distance fields can't be mixed on the same page, so all glyphs have to be rendered again.
+        // The pages are recreated with new textures, which are marked as containing distance fields or not.
+        for (unsigned int i = 0; i < m_pages.size(); ++i)
+            clearPage(i);
 
-        float fontHeight;
-        if (FT_IS_SCALABLE(m_face))
-            fontHeight = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender - m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
-        else // Use the line spacing when we don't have a scalable font
-            fontHeight = m_face->size->metrics.height / unitsPerPixel;
+        // Glyphs without a bitmap (e.g. spaces) remain after clearing the pages, but their advance is stored at the wrong size
+        m_glyphs.clear();
 
-        m_cachedFontHeights[scaledCharacterSize] = fontHeight;
-        return fontHeight / m_fontScale;
+        // Glyphs that are being rendered in the background still use the old mode
+        ++m_glyphGeneration;
+#else
+        (void)enabled;
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getAscent(unsigned int characterSize)
+    bool BackendFontFreetype::isDistanceFieldEnabled() const
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
-
-        const auto it = m_cachedAscents.find(scaledCharacterSize);
-        if (it != m_cachedAscents.end())
-            return it->second / m_fontScale;
-
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
-
-        float ascent;
-        if (FT_IS_SCALABLE(m_face))
-            ascent = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender, m_face->size->metrics.y_scale)) / unitsPerPixel);
-        else
-            ascent = m_face->size->metrics.ascender / unitsPerPixel;
-
-        m_cachedAscents[scaledCharacterSize] = ascent;
-        return ascent / m_fontScale;
+        return m_distanceFieldEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getDescent(unsigned int characterSize)
+    void BackendFontFreetype::setBackgroundRasterizationEnabled(bool enabled)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
-
-        const auto it = m_cachedDescents.find(scaledCharacterSize);
-        if (it != m_cachedDescents.end())
-            return it->second / m_fontScale;
-
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
+        m_backgroundRasterizationEnabled = enabled;
+        if (!enabled && m_prewarmWorker)
+        {
+            // Keep the glyphs that were already rendered, the glyphs that were still queued will be loaded when needed
+            commitPrewarmedGlyphs();
+            stopPrewarmWorker();
+        }
+    }
 
-        float descent;
-        if (FT_IS_SCALABLE(m_face))
-            descent = std::ceil(static_cast<float>(FT_MulFix(-m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
-        else
-            descent = -m_face->size->metrics.descender / unitsPerPixel;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        m_cachedDescents[scaledCharacterSize] = descent;
-        return descent / m_fontScale;
+    bool BackendFontFreetype::isBackgroundRasterizationEnabled() const
+    {
+        return m_backgroundRasterizationEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getUnderlinePosition(unsigned int characterSize)
+    void BackendFontFreetype::prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                                      const std::vector<unsigned int>& characterSizes, const std::vector<TextStyles>& styles)
     {
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
+        if (!m_face)
+            return;
 
-        // Return a fixed position if font is a bitmap font
-        if (!FT_IS_SCALABLE(m_face))
-            return characterSize / 10.f;
+        if (!m_backgroundRasterizationEnabled || !startPrewarmWorker())
+        {
+            BackendFont::prewarm(codePointRanges, characterSizes, styles);
+            return;
+        }
 
-        return -static_cast<float>(FT_MulFix(m_face->underline_position, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
-    }
+        // Queue every glyph that isn't loaded yet. Several character sizes share the same glyph in distance field mode.
+        std::vector<PrewarmWorker::Job> jobs;
+        std::unordered_set<std::uint64_t> queuedGlyphKeys;
+        for (const TextStyles style : styles)
+        {
+            const bool bold = (style & TextStyle::Bold) != 0;
+            for (const unsigned int characterSize : characterSizes)
+            {
+                if (characterSize == 0)
+                    continue;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                PrewarmWorker::Job job;
+                job.bold = bold;
+                job.distanceField = m_distanceFieldEnabled;
+                job.pixelSize = m_distanceFieldEnabled ? DistanceFieldReferenceSize : static_cast<unsigned int>(characterSize * m_fontScale);
+                job.pixelsPerUnit = m_distanceFieldEnabled ? (static_cast<float>(DistanceFieldReferenceSize) / characterSize) : m_fontScale;
+                job.generation = m_glyphGeneration;
 
-    float BackendFontFreetype::getUnderlineThickness(unsigned int characterSize)
-    {
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
+                for (const auto& range : codePointRanges)
+                {
+                    for (char32_t codePoint = range.first; codePoint <= range.second; ++codePoint)
+                    {
+                        job.codePoint = codePoint;
+                        job.glyphKey = getGlyphKey(codePoint, characterSize, bold, 0);
+                        if (hasGlyph(codePoint) && (m_glyphs.find(job.glyphKey) == m_glyphs.end()) && queuedGlyphKeys.insert(job.glyphKey).second)
+                            jobs.push_back(job);
+
+                        // Prevent an infinite loop when the range ends at the largest possible code point
+                        if (codePoint == range.second)
+                            break;
+                    }
+                }
+            }
+        }
 
-        // Return a fixed thickness if font is a bitmap font
-        if (!FT_IS_SCALABLE(m_face))
-            return characterSize / 14.f;
+        if (jobs.empty())
+            return;
 
-        return static_cast<float>(FT_MulFix(m_face->underline_thickness, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
+        {
+            const std::lock_guard<std::mutex> lock(m_prewarmWorker->mutex);
+            m_prewarmWorker->jobs.insert(m_prewarmWorker->jobs.end(), jobs.begin(), jobs.end());
+        }
+        m_prewarmWorker->condition.notify_one();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
+    void BackendFontFreetype::commitPrewarmedGlyphs()
     {
-        if (m_texture)
+        if (!m_prewarmWorker || !m_prewarmWorker->hasStagedGlyphs)
+            return;
+
+        std::vector<PrewarmWorker::StagedGlyph> stagedGlyphs;
         {
-            textureVersion = m_textureVersion;
-            return m_texture;
+            const std::lock_guard<std::mutex> lock(m_prewarmWorker->mutex);
+            stagedGlyphs.swap(m_prewarmWorker->stagedGlyphs);
+            m_prewarmWorker->hasStagedGlyphs = false;
         }
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        for (const auto& stagedGlyph : stagedGlyphs)
+        {
+            // Glyphs that were rendered with different settings or that were already loaded on this thread are discarded
+            if ((stagedGlyph.generation != m_glyphGeneration) || (m_glyphs.find(stagedGlyph.glyphKey) != m_glyphs.end()))
+                continue;
+
+            const Glyph& glyph = placeGlyph(stagedGlyph.rasterizedGlyph);
+            if (glyph.textureRect.width > 0)
+                m_pages[glyph.page].lastUsed = ++m_glyphUseCounter;
 
-        textureVersion = ++m_textureVersion;
-        return m_texture;
+            m_glyphs.insert({stagedGlyph.glyphKey, glyph});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Vector2u BackendFontFreetype::getTextureSize(unsigned int)
+    bool BackendFontFreetype::saveGlyphCache(const String& filename)
     {
-        return {m_textureSize, m_textureSize};
-    }
+        if (!m_face)
+            return false;
+
+        // Glyphs that were already rendered in the background should also be stored
+        commitPrewarmedGlyphs();
+
+        // The metrics are written per member, because the struct contains padding bytes
+        const auto writeGlyphMetrics = [](GlyphCacheWriter& glyphWriter, const GlyphMetrics& metrics) {
+            glyphWriter.write(metrics.advance);
+            glyphWriter.write(metrics.lsbDelta);
+            glyphWriter.write(metrics.rsbDelta);
+            glyphWriter.write(static_cast<std::uint8_t>(metrics.loaded ? 1 : 0));
+        };
+
+        GlyphCacheWriter writer;
+        for (const char c : GlyphCacheMagic)
+            writer.write(c);
+        writer.write(GlyphCacheVersion);
+        writer.write(GlyphCacheByteOrderMark);
+        writer.write(static_cast<std::uint64_t>(m_fileSize));
+        writer.write(hashFontData(m_fileContents.get(), m_fileSize));
+        writer.write(static_cast<std::uint8_t>(m_distanceFieldEnabled ? 1 : 0));
+        writer.write(m_fontScale);
+
+        // Only the alpha channel of the pages is stored, the color channels are always white
+        writer.write(static_cast<std::uint64_t>(m_pages.size()));
+        for (const auto& page : m_pages)
+        {
+            writer.write(page.size);
+            writer.write(static_cast<std::uint64_t>(page.skyline.size()));
+            for (const auto& node : page.skyline)
+            {
+                writer.write(node.x);
+                writer.write(node.y);
+                writer.write(node.width);
+            }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            for (std::size_t i = 0; i < static_cast<std::size_t>(page.size) * page.size; ++i)
+                writer.write(page.pixels[i * 4 + 3]);
+        }
 
-    void BackendFontFreetype::setSmooth(bool smooth)
-    {
-        BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
-    }
+        writer.write(static_cast<std::uint64_t>(m_glyphs.size()));
+        for (const auto& pair : m_glyphs)
+        {
+            writer.write(pair.first);
+            writer.write(pair.second);
+        }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        writer.write(static_cast<std::uint64_t>(m_metricsTables.size()));
+        for (const auto& pair : m_metricsTables)
+        {
+            const MetricsTable& table = pair.second;
+            writer.write(pair.first);
+            for (const auto& metrics : table.latinGlyphs)
+                writeGlyphMetrics(writer, metrics);
 
-    void BackendFontFreetype::setFontScale(float scale)
-    {
-        if (m_fontScale == scale)
-            return;
+            writer.write(static_cast<std::uint64_t>(table.otherGlyphs.size()));
+            for (const auto& glyphPair : table.otherGlyphs)
+            {
+                writer.write(glyphPair.first);
+                writeGlyphMetrics(writer, glyphPair.second);
+            }
 
-        BackendFont::setFontScale(scale);
+            writer.write(static_cast<std::uint64_t>(table.asciiKerning.size()));
+            for (const float kerning : table.asciiKerning)
+                writer.write(kerning);
+
+            writer.write(static_cast<std::uint64_t>(table.otherKerning.size()));
+            for (const auto& kerningPair : table.otherKerning)
+            {
+                writer.write(kerningPair.first);
+                writer.write(kerningPair.second);
+            }
+        }
+
+        for (const auto* cache : {&m_cachedLineSpacing, &m_cachedFontHeights, &m_cachedAscents, &m_cachedDescents})
+        {
+            writer.write(static_cast<std::uint64_t>(cache->size()));
+            for (const auto& pair : *cache)
+            {
+                writer.write(pair.first);
+                writer.write(pair.second);
+            }
+        }
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        return writeFile(filename, writer.data.data(), writer.data.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    bool BackendFontFreetype::loadGlyphCache(const String& filename)
     {
-        Glyph glyph;
         if (!m_face)
-            return glyph;
+            return false;
+
+        std::size_t fileSize = 0;
+        const auto fileContents = readFileToMemory(filename, fileSize);
+        if (!fileContents)
+            return false;
+
+        GlyphCacheReader reader;
+        reader.data = fileContents.get();
+        reader.size = fileSize;
+
+        std::array<char, 8> magic;
+        std::uint32_t version = 0;
+        std::uint32_t byteOrderMark = 0;
+        std::uint64_t fontSize = 0;
+        std::uint64_t fontHash = 0;
+        std::uint8_t distanceField = 0;
+        float fontScale = 0;
+        if (!reader.read(magic) || (magic != GlyphCacheMagic)
+         || !reader.read(version) || (version != GlyphCacheVersion)
+         || !reader.read(byteOrderMark) || (byteOrderMark != GlyphCacheByteOrderMark)
+         || !reader.read(fontSize) || (fontSize != m_fileSize)
+         || !reader.read(fontHash) || (fontHash != hashFontData(m_fileContents.get(), m_fileSize))
+         || !reader.read(distanceField) || ((distanceField != 0) != m_distanceFieldEnabled)
+         || !reader.read(fontScale) || (fontScale != m_fontScale)) // Stored metrics were divided by the font scale
+        {
+            return false;
+        }
 
-        if (!setCurrentSize(characterSize))
-            return glyph;
+        constexpr std::size_t glyphMetricsSize = (3 * sizeof(float)) + sizeof(std::uint8_t);
+        const auto readGlyphMetrics = [](GlyphCacheReader& glyphReader, GlyphMetrics& metrics) {
+            std::uint8_t loaded = 0;
+            if (!glyphReader.read(metrics.advance) || !glyphReader.read(metrics.lsbDelta) || !glyphReader.read(metrics.rsbDelta) || !glyphReader.read(loaded))
+                return false;
+
+            metrics.loaded = (loaded != 0);
+            return true;
+        };
+
+        // Everything is first read into temporary variables, the font is only changed when the entire file is valid
+        std::uint64_t pageCount = 0;
+        if (!reader.readCount(pageCount, sizeof(unsigned int)) || (pageCount == 0))
+            return false;
+
+        std::vector<Page> pages(static_cast<std::size_t>(pageCount));
+        const unsigned int maxPageSize = getMaximumPageSize();
+        for (auto& page : pages)
+        {
+            std::uint64_t nodeCount = 0;
+            if (!reader.read(page.size) || (page.size < 4) || (page.size > maxPageSize)
+             || !reader.readCount(nodeCount, sizeof(SkylineNode)) || (nodeCount == 0) || (nodeCount > page.size))
+                return false;
+
+            page.skyline.resize(static_cast<std::size_t>(nodeCount));
+            for (auto& node : page.skyline)
+            {
+                if (!reader.read(node.x) || !reader.read(node.y) || !reader.read(node.width)
+                 || (node.x >= page.size) || (node.y > page.size) || (node.width > page.size - node.x))
+                    return false;
+            }
+
+            const std::size_t pixelCount = static_cast<std::size_t>(page.size) * page.size;
+            if (pixelCount > reader.size - reader.offset)
+                return false;
+
+            page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount * 4);
+            for (std::size_t i = 0; i < pixelCount; ++i)
+            {
+                page.pixels[i * 4 + 0] = 255;
+                page.pixels[i * 4 + 1] = 255;
+                page.pixels[i * 4 + 2] = 255;
+                page.pixels[i * 4 + 3] = reader.data[reader.offset + i];
+            }
+            reader.offset += pixelCount;
+        }
+
+        std::uint64_t glyphCount = 0;
+        if (!reader.readCount(glyphCount, sizeof(std::uint64_t) + sizeof(Glyph)))
+            return false;
+
+        std::unordered_map<std::uint64_t, Glyph> glyphs;
+        glyphs.reserve(static_cast<std::size_t>(glyphCount));
+        for (std::uint64_t i = 0; i < glyphCount; ++i)
+        {
+            std::uint64_t glyphKey = 0;
+            Glyph glyph;
+            if (!reader.read(glyphKey) || !reader.read(glyph) || (glyph.page >= pages.size()))
+                return false;
+
+            const unsigned int pageSize = pages[glyph.page].size;
+            if ((glyph.textureRect.left > pageSize) || (glyph.textureRect.width > pageSize - glyph.textureRect.left)
+             || (glyph.textureRect.top > pageSize) || (glyph.textureRect.height > pageSize - glyph.textureRect.top))
+                return false;
+
+            glyphs.insert({glyphKey, glyph});
+        }
+
+        std::uint64_t tableCount = 0;
+        if (!reader.readCount(tableCount, sizeof(std::uint32_t) + (std::tuple_size<decltype(MetricsTable::latinGlyphs)>::value * glyphMetricsSize)))
+            return false;
+
+        std::unordered_map<std::uint32_t, MetricsTable> metricsTables;
+        for (std::uint64_t i = 0; i < tableCount; ++i)
+        {
+            std::uint32_t tableKey = 0;
+            MetricsTable table;
+            std::uint64_t otherGlyphCount = 0;
+            if (!reader.read(tableKey))
+                return false;
+
+            for (auto& metrics : table.latinGlyphs)
+            {
+                if (!readGlyphMetrics(reader, metrics))
+                    return false;
+            }
+
+            if (!reader.readCount(otherGlyphCount, sizeof(char32_t) + glyphMetricsSize))
+                return false;
+
+            for (std::uint64_t j = 0; j < otherGlyphCount; ++j)
+            {
+                char32_t codePoint = 0;
+                GlyphMetrics metrics;
+                if (!reader.read(codePoint) || !readGlyphMetrics(reader, metrics))
+                    return false;
+
+                table.otherGlyphs.insert({codePoint, metrics});
+            }
+
+            std::uint64_t asciiKerningCount = 0;
+            if (!reader.readCount(asciiKerningCount, sizeof(float)) || ((asciiKerningCount != 0) && (asciiKerningCount != 128 * 128)))
+                return false;
+
+            table.asciiKerning.resize(static_cast<std::size_t>(asciiKerningCount));
+            for (float& kerning : table.asciiKerning)
+            {
+                if (!reader.read(kerning))
+                    return false;
+            }
+
+            std::uint64_t otherKerningCount = 0;
+            if (!reader.readCount(otherKerningCount, sizeof(std::uint64_t) + sizeof(float)))
+                return false;
+
+            for (std::uint64_t j = 0; j < otherKerningCount; ++j)
+            {
+                std::uint64_t kerningKey = 0;
+                float kerning = 0;
+                if (!reader.read(kerningKey) || !reader.read(kerning))
+                    return false;
+
+                table.otherKerning.insert({kerningKey, kerning});
+            }
+
+            metricsTables.insert({tableKey, std::move(table)});
+        }
+
+        std::array<std::unordered_map<unsigned int, float>, 4> caches;
+        for (auto& cache : caches)
+        {
+            std::uint64_t count = 0;
+            if (!reader.readCount(count, sizeof(unsigned int) + sizeof(float)))
+                return false;
+
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                unsigned int characterSize = 0;
+                float value = 0;
+                if (!reader.read(characterSize) || !reader.read(value))
+                    return false;
+
+                cache.insert({characterSize, value});
+            }
+        }
+
+        // The file is valid, replace the glyphs of the font.
+        // The restored pages are marked as used, so that they aren't the first to be evicted when new glyphs are added.
+        m_pages = std::move(pages);
+        for (auto& page : m_pages)
+            page.lastUsed = ++m_glyphUseCounter;
+
+        m_glyphs = std::move(glyphs);
+        m_metricsTables = std::move(metricsTables);
+        m_lastMetricsTable = nullptr;
+        m_cachedLineSpacing = std::move(caches[0]);
+        m_cachedFontHeights = std::move(caches[1]);
+        m_cachedAscents = std::move(caches[2]);
+        m_cachedDescents = std::move(caches[3]);
+
+        // Glyphs that are being rendered in the background would be placed on pages that no longer exist
+        ++m_glyphGeneration;
+
+        // Texts have to update their texture coordinates
+        ++m_textureVersion;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getLineSpacing(unsigned int characterSize)
+    {
+        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+
+        const auto it = m_cachedLineSpacing.find(scaledCharacterSize);
+        if (it != m_cachedLineSpacing.end())
+            return it->second / m_fontScale;
+
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        const float lineSpacing = m_face->size->metrics.height / unitsPerPixel;
+        m_cachedLineSpacing[scaledCharacterSize] = lineSpacing;
+        return lineSpacing / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getFontHeight(unsigned int characterSize)
+    {
+        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+
+        const auto it = m_cachedFontHeights.find(scaledCharacterSize);
+        if (it != m_cachedFontHeights.end())
+            return it->second / m_fontScale;
+
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        float fontHeight;
+        if (FT_IS_SCALABLE(m_face))
+            fontHeight = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender - m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        else // Use the line spacing when we don't have a scalable font
+            fontHeight = m_face->size->metrics.height / unitsPerPixel;
+
+        m_cachedFontHeights[scaledCharacterSize] = fontHeight;
+        return fontHeight / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getAscent(unsigned int characterSize)
+    {
+        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+
+        const auto it = m_cachedAscents.find(scaledCharacterSize);
+        if (it != m_cachedAscents.end())
+            return it->second / m_fontScale;
+
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        float ascent;
+        if (FT_IS_SCALABLE(m_face))
+            ascent = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        else
+            ascent = m_face->size->metrics.ascender / unitsPerPixel;
+
+        m_cachedAscents[scaledCharacterSize] = ascent;
+        return ascent / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getDescent(unsigned int characterSize)
+    {
+        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+
+        const auto it = m_cachedDescents.find(scaledCharacterSize);
+        if (it != m_cachedDescents.end())
+            return it->second / m_fontScale;
+
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        float descent;
+        if (FT_IS_SCALABLE(m_face))
+            descent = std::ceil(static_cast<float>(FT_MulFix(-m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        else
+            descent = -m_face->size->metrics.descender / unitsPerPixel;
+
+        m_cachedDescents[scaledCharacterSize] = descent;
+        return descent / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getUnderlinePosition(unsigned int characterSize)
+    {
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        // Return a fixed position if font is a bitmap font
+        if (!FT_IS_SCALABLE(m_face))
+            return characterSize / 10.f;
+
+        return -static_cast<float>(FT_MulFix(m_face->underline_position, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getUnderlineThickness(unsigned int characterSize)
+    {
+        if (!m_face || !setCurrentSize(characterSize))
+            return 0;
+
+        // Return a fixed thickness if font is a bitmap font
+        if (!FT_IS_SCALABLE(m_face))
+            return characterSize / 14.f;
+
+        return static_cast<float>(FT_MulFix(m_face->underline_thickness, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize, unsigned int& textureVersion)
+    {
+        return getPageTexture(characterSize, 0, textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::getTextureVersion(unsigned int, unsigned int& textureVersion) const
+    {
+        textureVersion = m_textureVersion;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontFreetype::getTextureSize(unsigned int characterSize)
+    {
+        return getPageTextureSize(characterSize, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getPageTexture(unsigned int, unsigned int pageIndex, unsigned int& textureVersion)
+    {
+        textureVersion = m_textureVersion;
+        if (pageIndex >= m_pages.size())
+            return nullptr;
+
+        Page& page = m_pages[pageIndex];
+        if (page.texture && (page.dirtyRowsBegin < page.dirtyRowsEnd))
+        {
+            // Only upload the rows that contain new glyphs. Since the rows span the entire width of the page,
+            // their pixels are stored contiguously and can be passed to the texture without copying them first.
+            const UIntRect region{0, page.dirtyRowsBegin, page.size, page.dirtyRowsEnd - page.dirtyRowsBegin};
+            if (!page.texture->updateRegion(region, &page.pixels[page.dirtyRowsBegin * page.size * 4]))
+                page.texture->loadTextureOnly({page.size, page.size}, page.pixels.get(), m_isSmooth);
+        }
+        else if (!page.texture)
+        {
+            page.texture = getBackend()->getRenderer()->createTexture();
+            page.texture->setDistanceField(m_distanceFieldEnabled);
+            page.texture->loadTextureOnly({page.size, page.size}, page.pixels.get(), m_isSmooth);
+        }
+
+        page.dirtyRowsBegin = 0;
+        page.dirtyRowsEnd = 0;
+        return page.texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontFreetype::getPageTextureSize(unsigned int, unsigned int pageIndex)
+    {
+        if (pageIndex >= m_pages.size())
+            return {0, 0};
+
+        return {m_pages[pageIndex].size, m_pages[pageIndex].size};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setAtlasMemoryLimit(std::size_t bytes)
+    {
+        m_atlasMemoryLimit = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasMemoryLimit() const
+    {
+        return m_atlasMemoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasMemoryUsage() const
+    {
+        std::size_t usage = 0;
+        for (const auto& page : m_pages)
+            usage += static_cast<std::size_t>(page.size) * page.size * 4;
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setSmooth(bool smooth)
+    {
+        BackendFont::setSmooth(smooth);
+        for (auto& page : m_pages)
+        {
+            if (page.texture)
+                page.texture->setSmooth(m_isSmooth);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setFontScale(float scale)
+    {
+        if (m_fontScale == scale)
+            return;
+
+        BackendFont::setFontScale(scale);
+
+        // The cached metrics are stored in unscaled units
+        m_metricsTables.clear();
+        m_lastMetricsTable = nullptr;
+
+        // Change the texture version to force texts to update their glyphs
+        ++m_textureVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        if (!m_face)
+            return {};
+
+        // In distance field mode every glyph is rendered at the same reference size, no matter which character size is requested.
+        // Outline thickness and bold weight are specified relative to the requested size and thus have to be scaled.
+        const unsigned int pixelSize = m_distanceFieldEnabled ? DistanceFieldReferenceSize : static_cast<unsigned int>(characterSize * m_fontScale);
+        const float pixelsPerUnit = m_distanceFieldEnabled ? (static_cast<float>(DistanceFieldReferenceSize) / characterSize) : m_fontScale;
+
+        RasterizedGlyph rasterizedGlyph;
+        if (!rasterizeGlyph(m_library, m_face, m_stroker, codePoint, pixelSize, pixelsPerUnit, m_distanceFieldEnabled, bold, outlineThickness, rasterizedGlyph))
+            return {};
+
+        return placeGlyph(rasterizedGlyph);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint, unsigned int pixelSize,
+                                             float pixelsPerUnit, bool distanceField, bool bold, float outlineThickness, RasterizedGlyph& result)
+    {
+        if (!setPixelSize(face, pixelSize))
+            return false;
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -369,30 +1122,31 @@ namespace tgui
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
-        if (FT_Load_Char(m_face, codePoint, flags) != 0)
-            return glyph;
+        if (FT_Load_Char(face, codePoint, flags) != 0)
+            return false;
 
         // Retrieve the glyph
         FT_Glyph glyphDesc;
-        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
-            return glyph;
+        if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+            return false;
 
         // Add an outline if requested and the font supports it
         if ((outlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
         {
             // Create the stroker if this is the first time an outline was requested with this font
-            if (!m_stroker)
-                FT_Stroker_New(m_library, &m_stroker);
+            if (!stroker)
+                FT_Stroker_New(library, &stroker);
 
-            if (m_stroker)
+            if (stroker)
             {
-                FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(outlineThickness * m_fontScale * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-                FT_Glyph_Stroke(&glyphDesc, m_stroker, true);
+                FT_Stroker_Set(stroker, static_cast<FT_Fixed>(outlineThickness * pixelsPerUnit * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+                FT_Glyph_Stroke(&glyphDesc, stroker, true);
             }
         }
 
-        // Apply the bold style if requested and outlines are supported
-        const FT_Pos boldWeight = 1 << 6;
+        // Apply the bold style if requested and outlines are supported.
+        // Distance field glyphs are emboldened by the amount that a one pixel weight would have at a character size of 16.
+        const FT_Pos boldWeight = distanceField ? ((DistanceFieldReferenceSize / 16) << 6) : (1 << 6);
         const bool outlineSupport = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
         if (bold && outlineSupport)
         {
@@ -402,10 +1156,15 @@ namespace tgui
 
         // Rasterize the glyph to a bitmap
         // Warning: use bitmapGlyph->root instead of glyphDesc to access the glyph after this conversion
-        if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
+#if TGUI_FREETYPE_HAS_SDF
+        const FT_Render_Mode renderMode = distanceField ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL;
+#else
+        const FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#endif
+        if (FT_Glyph_To_Bitmap(&glyphDesc, renderMode, nullptr, 1) != 0)
         {
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return false;
         }
         FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
         FT_Bitmap& bitmap = bitmapGlyph->bitmap;
@@ -413,189 +1172,634 @@ namespace tgui
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method.
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
         if (bold && !outlineSupport)
-            FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
+            FT_Bitmap_Embolden(library, &bitmap, boldWeight, boldWeight);
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
+        Glyph& glyph = result.glyph;
         glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
         if (bold)
             glyph.advance += static_cast<float>(boldWeight) / unitsPerPixel;
 
-        glyph.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
-        glyph.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        glyph.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        glyph.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
+
+        // Compute the glyph's bounding box
+        glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
+        glyph.bounds.top = static_cast<float>(-bitmapGlyph->top);
+        glyph.bounds.width = static_cast<float>(bitmap.width);
+        glyph.bounds.height = static_cast<float>(bitmap.rows);
+
+        result.width = bitmap.width;
+        result.height = bitmap.rows;
+        result.distanceField = distanceField && (bitmap.pixel_mode == FT_PIXEL_MODE_GRAY);
+        result.alpha.resize(static_cast<std::size_t>(bitmap.width) * bitmap.rows);
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            {
+                for (unsigned int x = 0; x < bitmap.width; ++x)
+                    result.alpha[(y * bitmap.width) + x] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bits gray levels
+            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            {
+                for (unsigned int x = 0; x < bitmap.width; ++x)
+                    result.alpha[(y * bitmap.width) + x] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+            }
+        }
+
+        FT_Done_Glyph(glyphDesc);
+        return true;
+    }
 
-        // Compute the glyph's bounding box
-        glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
-        glyph.bounds.top = static_cast<float>(-bitmapGlyph->top);
-        glyph.bounds.width = static_cast<float>(bitmap.width);
-        glyph.bounds.height = static_cast<float>(bitmap.rows);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if ((bitmap.width == 0) || (bitmap.rows == 0))
+    BackendFontFreetype::Glyph BackendFontFreetype::placeGlyph(const RasterizedGlyph& rasterizedGlyph)
+    {
+        Glyph glyph = rasterizedGlyph.glyph;
+        if ((rasterizedGlyph.width == 0) || (rasterizedGlyph.height == 0))
         {
             // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
-            FT_Done_Glyph(glyphDesc);
             return glyph;
         }
 
         // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
         const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
+        glyph.textureRect = findAvailableGlyphRect(rasterizedGlyph.width + (2 * padding), rasterizedGlyph.height + (2 * padding), glyph.page);
         glyph.textureRect.left += padding;
         glyph.textureRect.top += padding;
         glyph.textureRect.width -= 2 * padding;
         glyph.textureRect.height -= 2 * padding;
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        // Copy the pixels to the page. The color channels remain white, we only have to fill the alpha channel.
+        Page& page = m_pages[glyph.page];
+        for (unsigned int y = 0; y < rasterizedGlyph.height; ++y)
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            for (unsigned int x = 0; x < rasterizedGlyph.width; ++x)
             {
-                for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
-                }
+                const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.size;
+                page.pixels[index * 4 + 3] = rasterizedGlyph.alpha[(y * rasterizedGlyph.width) + x];
             }
         }
+
+        // The rows containing the glyph will have to be uploaded to the texture again
+        if (page.dirtyRowsBegin < page.dirtyRowsEnd)
+        {
+            page.dirtyRowsBegin = std::min(page.dirtyRowsBegin, glyph.textureRect.top);
+            page.dirtyRowsEnd = std::max(page.dirtyRowsEnd, glyph.textureRect.top + glyph.textureRect.height);
+        }
         else
         {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            page.dirtyRowsBegin = glyph.textureRect.top;
+            page.dirtyRowsEnd = glyph.textureRect.top + glyph.textureRect.height;
+        }
+
+        // A distance field has a margin around the outline that is as wide as the spread. Most of it is excluded from the glyph,
+        // so that its bounds are close to the bounds of a normal glyph. Only a few pixels are kept to anti-alias the edges.
+        if (rasterizedGlyph.distanceField)
+        {
+            const unsigned int margin = DistanceFieldSpread - 2;
+            if ((glyph.textureRect.width > 2 * margin) && (glyph.textureRect.height > 2 * margin))
             {
-                for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
-                }
+                glyph.textureRect.left += margin;
+                glyph.textureRect.top += margin;
+                glyph.textureRect.width -= 2 * margin;
+                glyph.textureRect.height -= 2 * margin;
+                glyph.bounds.left += static_cast<float>(margin);
+                glyph.bounds.top += static_cast<float>(margin);
+                glyph.bounds.width -= static_cast<float>(2 * margin);
+                glyph.bounds.height -= static_cast<float>(2 * margin);
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
-
-        FT_Done_Glyph(glyphDesc);
         return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::uint64_t BackendFontFreetype::getGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        // Distance field glyphs are shared between all character sizes, only the outline thickness relative to the size matters
+        if (m_distanceFieldEnabled)
+            return constructGlyphKey(codePoint, DistanceFieldReferenceSize, bold, outlineThickness * DistanceFieldReferenceSize / characterSize);
+        else
+            return constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale), bold, outlineThickness * m_fontScale);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
-                                                         bold, outlineThickness * m_fontScale);
+        const std::uint64_t glyphKey = getGlyphKey(codePoint, characterSize, bold, outlineThickness);
+
+        auto it = m_glyphs.find(glyphKey);
+        if ((it == m_glyphs.end()) && m_prewarmWorker && m_prewarmWorker->hasStagedGlyphs)
+        {
+            // The glyph might have been rendered in the background already
+            commitPrewarmedGlyphs();
+            it = m_glyphs.find(glyphKey);
+        }
 
-        const auto it = m_glyphs.find(glyphKey);
         if (it != m_glyphs.end())
+        {
+            if (it->second.textureRect.width > 0)
+                m_pages[it->second.page].lastUsed = ++m_glyphUseCounter;
+
             return it->second;
+        }
 
         const Glyph& glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
+        if (glyph.textureRect.width > 0)
+            m_pages[glyph.page].lastUsed = ++m_glyphUseCounter;
+
         return m_glyphs.insert({glyphKey, glyph}).first->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    BackendFontFreetype::MetricsTable& BackendFontFreetype::getMetricsTable(unsigned int characterSize, bool bold)
     {
-        // Find the line that where the glyph fits well.
-        // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
-        Row* bestRow = nullptr;
-        float bestRatio = 0;
-        for (auto& row : m_rows)
+        const std::uint32_t tableKey = (static_cast<std::uint32_t>(characterSize * m_fontScale) << 1) | (bold ? 1u : 0u);
+        if (m_lastMetricsTable && (m_lastMetricsTableKey == tableKey))
+            return *m_lastMetricsTable;
+
+        // When the atlas has a memory limit, the table that wasn't used for the longest time is removed before adding a new one
+        if ((m_atlasMemoryLimit > 0) && (m_metricsTables.size() >= MaxMetricsTables) && (m_metricsTables.find(tableKey) == m_metricsTables.end()))
         {
-            float ratio = static_cast<float>(height) / row.height;
+            auto leastRecentlyUsedIt = m_metricsTables.begin();
+            for (auto it = m_metricsTables.begin(); it != m_metricsTables.end(); ++it)
+            {
+                if (it->second.lastUsed < leastRecentlyUsedIt->second.lastUsed)
+                    leastRecentlyUsedIt = it;
+            }
 
-            // Ignore rows that are either too small or too high
-            if ((ratio < 0.7f) || (ratio > 1.f))
-                continue;
+            if (&leastRecentlyUsedIt->second == m_lastMetricsTable)
+                m_lastMetricsTable = nullptr;
+
+            m_metricsTables.erase(leastRecentlyUsedIt);
+        }
+
+        // Elements of an unordered_map are never moved in memory, so the pointer remains valid when other tables are added
+        m_lastMetricsTable = &m_metricsTables[tableKey];
+        m_lastMetricsTable->lastUsed = ++m_glyphUseCounter;
+        m_lastMetricsTableKey = tableKey;
+        return *m_lastMetricsTable;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
+    const BackendFontFreetype::GlyphMetrics& BackendFontFreetype::getGlyphMetrics(MetricsTable& table, char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        GlyphMetrics& metrics = (codePoint < table.latinGlyphs.size()) ? table.latinGlyphs[codePoint] : table.otherGlyphs[codePoint];
+        if (!metrics.loaded)
+            metrics = loadGlyphMetrics(codePoint, characterSize, bold);
+
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::GlyphMetrics BackendFontFreetype::loadGlyphMetrics(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        GlyphMetrics metrics;
+        metrics.loaded = true;
+
+        if (!setCurrentSize(characterSize))
+            return metrics;
+
+        // Use the same flags as in loadGlyph, but without rendering the glyph to a bitmap
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+        const FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+        if (FT_Load_Char(m_face, codePoint, flags) != 0)
+            return metrics;
+
+        // The advance is a whole number of pixels because we use FT_LOAD_FORCE_AUTOHINT flag
+        float advance = static_cast<float>(m_face->glyph->advance.x >> 6);
+        if (bold)
+            advance += 1; // loadGlyph emboldens glyphs by one pixel
+
+        metrics.advance = advance / m_fontScale;
+        metrics.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
+        metrics.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::calculateKerning(MetricsTable& table, char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+        const float firstRsbDelta = getGlyphMetrics(table, first, characterSize, bold).rsbDelta;
+        const float secondLsbDelta = getGlyphMetrics(table, second, characterSize, bold).lsbDelta;
+
+        if (!setCurrentSize(characterSize))
+            return 0;
+
+        // Get the kerning vector if present
+        FT_Vector kerning;
+        kerning.x = kerning.y = 0;
+        if (FT_HAS_KERNING(m_face))
+        {
+            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
+            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
+            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+        }
+
+        // X advance is already in pixels for bitmap fonts
+        if (!FT_IS_SCALABLE(m_face))
+            return static_cast<float>(kerning.x) / m_fontScale;
+
+        // Combine kerning with compensation deltas and return the X advance
+        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+        return std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / unitsPerPixel) / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int& pageIndex)
+    {
+        const unsigned int maxPageSize = getMaximumPageSize();
+        while (true)
+        {
+            // Look for the page where the glyph can be placed the closest to the top
+            std::size_t bestNodeIndex = 0;
+            Vector2u bestPosition;
+            bool positionFound = false;
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                std::size_t nodeIndex;
+                Vector2u position;
+                if (!findPositionOnPage(m_pages[i], width, height, nodeIndex, position))
+                    continue;
+
+                if (positionFound && (position.y >= bestPosition.y))
+                    continue;
+
+                bestNodeIndex = nodeIndex;
+                bestPosition = position;
+                pageIndex = static_cast<unsigned int>(i);
+                positionFound = true;
+            }
+
+            if (positionFound)
+            {
+                reservePageArea(m_pages[pageIndex], bestNodeIndex, bestPosition, width, height);
+                return {bestPosition.x, bestPosition.y, width, height};
+            }
+
+            // The last page grows until it reaches the maximum size.
+            // A page that is still empty can grow beyond the maximum size if the glyph wouldn't fit otherwise.
+            Page& lastPage = m_pages.back();
+            if ((lastPage.size < maxPageSize) || isPageEmpty(lastPage))
+            {
+                growPage(lastPage);
                 continue;
+            }
 
-            // Make sure that this new row is the best found so far
-            if (ratio < bestRatio)
+            // Start a new page if this doesn't cause the atlas to use more memory than allowed
+            const std::size_t newPageMemory = static_cast<std::size_t>(maxPageSize) * maxPageSize * 4;
+            if ((m_atlasMemoryLimit == 0) || (getAtlasMemoryUsage() + newPageMemory <= m_atlasMemoryLimit))
+            {
+                addPage(maxPageSize);
                 continue;
+            }
 
-            // The current row passed all the tests: we can select it
-            bestRow = &row;
-            bestRatio = ratio;
+            // The memory limit has been reached, so the page that wasn't used for the longest time gets cleared to make room
+            std::size_t leastRecentlyUsedPage = 0;
+            for (std::size_t i = 1; i < m_pages.size(); ++i)
+            {
+                if (m_pages[i].lastUsed < m_pages[leastRecentlyUsedPage].lastUsed)
+                    leastRecentlyUsedPage = i;
+            }
+
+            clearPage(static_cast<unsigned int>(leastRecentlyUsedPage));
+
+            // The cleared page might still be too small for a glyph that didn't fit on a page of the maximum size
+            Page& clearedPage = m_pages[leastRecentlyUsedPage];
+            std::size_t nodeIndex;
+            Vector2u position;
+            while (!findPositionOnPage(clearedPage, width, height, nodeIndex, position))
+                growPage(clearedPage);
+
+            reservePageArea(clearedPage, nodeIndex, position, width, height);
+            pageIndex = static_cast<unsigned int>(leastRecentlyUsedPage);
+            return {position.x, position.y, width, height};
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // If we didn't find a matching row, create a new one (10% taller than the glyph)
-        if (!bestRow)
+    bool BackendFontFreetype::findPositionOnPage(const Page& page, unsigned int width, unsigned int height, std::size_t& nodeIndex, Vector2u& position)
+    {
+        // Find the segment of the skyline where the bottom of the rectangle would end up the highest.
+        // When multiple segments are equally good, the narrowest one is chosen to leave the wider spaces for larger glyphs.
+        bool positionFound = false;
+        unsigned int bestBottom = 0;
+        unsigned int bestWidth = 0;
+        for (std::size_t i = 0; i < page.skyline.size(); ++i)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
-            const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            const unsigned int left = page.skyline[i].x;
+            if (left + width > page.size)
+                break;
+
+            // The rectangle rests on the highest segment that it spans
+            unsigned int top = 0;
+            unsigned int widthLeft = width;
+            for (std::size_t j = i; widthLeft > 0; ++j)
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
+                top = std::max(top, page.skyline[j].y);
+                widthLeft -= std::min(widthLeft, page.skyline[j].width);
+            }
 
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+            if (top + height > page.size)
+                continue;
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
-                }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
-                {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
-                }
+            const unsigned int bottom = top + height;
+            if (positionFound && ((bottom > bestBottom) || ((bottom == bestBottom) && (page.skyline[i].width >= bestWidth))))
+                continue;
+
+            positionFound = true;
+            bestBottom = bottom;
+            bestWidth = page.skyline[i].width;
+            nodeIndex = i;
+            position = {left, top};
+        }
+
+        return positionFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isPageEmpty(const Page& page)
+    {
+        // Only the first segment, which lies below the square in the top left corner, is raised on a page without glyphs
+        for (std::size_t i = 1; i < page.skyline.size(); ++i)
+        {
+            if (page.skyline[i].y > 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    void BackendFontFreetype::reservePageArea(Page& page, std::size_t nodeIndex, Vector2u position, unsigned int width, unsigned int height)
+    {
+        page.skyline.insert(page.skyline.begin() + static_cast<std::ptrdiff_t>(nodeIndex), {position.x, position.y + height, width});
+
+        // Shorten or remove the segments that are now covered by the new one
+        const unsigned int right = position.x + width;
+        const std::size_t i = nodeIndex + 1;
+        while (i < page.skyline.size())
+        {
+            SkylineNode& node = page.skyline[i];
+            if (node.x >= right)
+                break;
+
+            if (node.x + node.width <= right)
+            {
+                page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+
+            node.width -= right - node.x;
+            node.x = right;
+            break;
+        }
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+        // Merge neighboring segments that have the same height
+        for (std::size_t j = 0; j + 1 < page.skyline.size();)
+        {
+            if (page.skyline[j].y == page.skyline[j + 1].y)
+            {
+                page.skyline[j].width += page.skyline[j + 1].width;
+                page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(j + 1));
             }
+            else
+                ++j;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addPage(unsigned int size)
+    {
+        Page page;
+        page.size = size;
+        page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(size * size * 4);
+
+        std::uint8_t* pixelPtr = page.pixels.get();
+        for (unsigned int i = 0; i < size * size; ++i)
+        {
+            // Color is always white, alpha channel contains whether the pixel is empty of not
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 0;
+        }
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                page.pixels[((size * y) + x) * 4 + 3] = 255;
+        }
+
+        // The square and an extra row and column of padding are excluded from the area where glyphs can be placed
+        page.skyline = {{0, 3, 3}, {3, 0, size - 3}};
+
+        m_pages.push_back(std::move(page));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::clearPage(unsigned int pageIndex)
+    {
+        Page& page = m_pages[pageIndex];
+
+        // Make all pixels transparent again, except for the square in the top left corner that is used for underlining
+        for (unsigned int y = 0; y < page.size; ++y)
+        {
+            for (unsigned int x = (y < 2) ? 2 : 0; x < page.size; ++x)
+                page.pixels[((page.size * y) + x) * 4 + 3] = 0;
+        }
+
+        page.skyline = {{0, 3, 3}, {3, 0, page.size - 3}};
+        page.texture = nullptr;
+        page.dirtyRowsBegin = 0;
+        page.dirtyRowsEnd = 0;
+        page.lastUsed = 0;
+
+        // Forget the glyphs that were stored on the page, they will be loaded again when they are needed
+        for (auto it = m_glyphs.begin(); it != m_glyphs.end();)
+        {
+            if ((it->second.page == pageIndex) && (it->second.textureRect.width > 0))
+                it = m_glyphs.erase(it);
+            else
+                ++it;
+        }
 
-            // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+        // Texts that used glyphs from this page have to update their vertices
+        ++m_textureVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::growPage(Page& page)
+    {
+        // Copy existing pixels to the top left quadrant
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((page.size * 2) * (page.size * 2) * 4);
+        for (unsigned int y = 0; y < page.size; ++y)
+            std::memcpy(&pixels[y * (2 * page.size) * 4], &page.pixels[y * page.size * 4], page.size * 4);
+
+        // Top right quadrant and bottom halves are filled with empty values
+        // Color is always white, alpha channel contains whether the pixel is empty of not
+        for (unsigned int y = 0; y < page.size; ++y)
+        {
+            std::uint8_t* pixelPtr = &pixels[((y * (2 * page.size)) + page.size) * 4];
+            for (unsigned int i = 0; i < page.size; ++i)
+            {
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 0;
+            }
         }
+        std::uint8_t* pixelPtr = &pixels[page.size * (2 * page.size) * 4];
+        for (unsigned int i = 0; i < (2 * page.size) * page.size; ++i)
+        {
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 0;
+        }
+
+        // The new space on the right side of the page is added to the skyline
+        page.skyline.push_back({page.size, 0, page.size});
+
+        page.pixels = std::move(pixels);
+        page.size *= 2;
+        page.texture = nullptr;
+        page.dirtyRowsBegin = 0;
+        page.dirtyRowsEnd = 0;
 
-        // Find the glyph's rectangle on the selected row
-        UIntRect rect{bestRow->width, bestRow->top, width, height};
+        // The texture coordinates of the existing glyphs on this page changed, so texts need to update their vertices
+        ++m_textureVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getMaximumPageSize() const
+    {
+        // Larger pages would mean less texture switches while drawing, but a page needs to be reuploaded when a glyph is added
+        unsigned int maxPageSize = 1024;
+        if (isBackendSet() && getBackend()->hasRenderer())
+        {
+            const unsigned int maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+            if (maxTextureSize > 0)
+                maxPageSize = std::min(maxPageSize, maxTextureSize);
+        }
 
-        // Update the row informations
-        bestRow->width += width;
-        return rect;
+        return maxPageSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+        return setPixelSize(m_face, static_cast<unsigned int>(characterSize * m_fontScale));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendFontFreetype::setPixelSize(FT_Face face, unsigned int pixelSize)
+    {
         // Don't call FT_Set_Pixel_Sizes if we don't have to
-        if (scaledCharacterSize == m_face->size->metrics.x_ppem)
+        if (pixelSize == face->size->metrics.x_ppem)
+            return true;
+
+        return (FT_Set_Pixel_Sizes(face, 0, pixelSize) == FT_Err_Ok);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::startPrewarmWorker()
+    {
+        if (m_prewarmWorker)
             return true;
 
-        return (FT_Set_Pixel_Sizes(m_face, 0, scaledCharacterSize) == FT_Err_Ok);
+        if (!m_fileContents)
+            return false;
+
+        // FreeType objects can't be shared between threads, so the worker loads the font again from the same memory
+        auto worker = std::make_unique<PrewarmWorker>();
+        if (FT_Init_FreeType(&worker->library) != 0)
+            return false;
+
+#if TGUI_FREETYPE_HAS_SDF
+        FT_UInt spread = DistanceFieldSpread;
+        FT_Property_Set(worker->library, "sdf", "spread", &spread);
+        FT_Property_Set(worker->library, "bsdf", "spread", &spread);
+#endif
+
+        if ((FT_New_Memory_Face(worker->library, static_cast<const FT_Byte*>(m_fileContents.get()), static_cast<FT_Long>(m_fileSize), 0, &worker->face) != 0)
+         || (FT_Select_Charmap(worker->face, FT_ENCODING_UNICODE) != 0))
+        {
+            if (worker->face)
+                FT_Done_Face(worker->face);
+
+            FT_Done_FreeType(worker->library);
+            return false;
+        }
+
+        PrewarmWorker* workerPtr = worker.get();
+        worker->thread = std::thread([workerPtr]{ workerPtr->run(); });
+        m_prewarmWorker = std::move(worker);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::stopPrewarmWorker()
+    {
+        if (!m_prewarmWorker)
+            return;
+
+        {
+            const std::lock_guard<std::mutex> lock(m_prewarmWorker->mutex);
+            m_prewarmWorker->stopRequested = true;
+        }
+        m_prewarmWorker->condition.notify_one();
+        m_prewarmWorker->thread.join();
+
+        if (m_prewarmWorker->stroker)
+            FT_Stroker_Done(m_prewarmWorker->stroker);
+
+        FT_Done_Face(m_prewarmWorker->face);
+        FT_Done_FreeType(m_prewarmWorker->library);
+        m_prewarmWorker = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::cleanup()
     {
+        // The worker uses the file contents, so it has to be stopped before they are released
+        stopPrewarmWorker();
+
         if (m_stroker)
             FT_Stroker_Done(m_stroker);
 
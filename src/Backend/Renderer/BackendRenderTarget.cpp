@@ -28,8 +28,11 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <array>
     #include <cmath>
+    #include <limits>
+    #include <numeric>
 
     #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
         #include <numbers>
@@ -185,10 +188,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTarget::drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect)
+    {
+        drawGui(root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
         // If the widget lies outside of the clip rect then we can skip drawing it
-        const FloatRect& clipRect = m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+        const FloatRect clipRect = getClipRect();
         const FloatRect& widgetRect = states.transform.transformRect({widget->getWidgetOffset(), widget->getFullSize()});
         if ((widgetRect.left > clipRect.left + clipRect.width) || (widgetRect.top > clipRect.top + clipRect.height)
          || (widgetRect.left + widgetRect.width < clipRect.left) || (widgetRect.top + widgetRect.height < clipRect.top))
@@ -227,6 +237,9 @@ namespace tgui
         const float clipRight = std::min(transformedRect.left + transformedRect.width, oldClipRect.left + oldClipRect.width);
         const float clipBottom = std::min(transformedRect.top + transformedRect.height, oldClipRect.top + oldClipRect.height);
 
+        // Draw calls that were recorded inside the previous clipping area have to be executed before the clipping changes
+        const FloatRect oldClipViewport = m_clipLayers.empty() ? m_viewport : m_clipLayers.back().second;
+
         if ((clipRight - clipLeft > 0) && (clipBottom - clipTop > 0))
         {
             const FloatRect clipRect = {clipLeft, clipTop, clipRight - clipLeft, clipBottom - clipTop};
@@ -236,11 +249,16 @@ namespace tgui
                 m_viewport.width * ((clipRight - clipLeft) / m_viewRect.width),
                 m_viewport.height * ((clipBottom - clipTop) / m_viewRect.height)
             };
+            if (clipViewport != oldClipViewport)
+                flushDeferredDrawCalls();
+
             m_clipLayers.emplace_back(clipRect, clipViewport);
             updateClipping(clipRect, clipViewport);
         }
         else // Entire window is being clipped
         {
+            flushDeferredDrawCalls();
+
             m_clipLayers.emplace_back(FloatRect{}, FloatRect{});
             updateClipping({}, {});
         }
@@ -252,7 +270,13 @@ namespace tgui
     {
         TGUI_ASSERT(!m_clipLayers.empty(), "BackendRenderTarget::removeClippingLayer can't remove layer if there are none left");
 
+        const FloatRect oldClipViewport = m_clipLayers.back().second;
         m_clipLayers.pop_back();
+
+        const FloatRect newClipViewport = m_clipLayers.empty() ? m_viewport : m_clipLayers.back().second;
+        if (newClipViewport != oldClipViewport)
+            flushDeferredDrawCalls();
+
         if (m_clipLayers.empty())
             updateClipping(m_viewRect, m_viewport);
         else
@@ -484,12 +508,176 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTarget::beginRenderToTexture(std::shared_ptr<BackendTexture>&, Vector2f)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::endRenderToTexture()
+    {
+        TGUI_ASSERT(false, "endRenderToTexture called on a render target that doesn't support rendering to textures");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRenderedTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture, Vector2f size)
+    {
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 0}},
+            {{size.x, 0}, vertexColor, {1, 0}},
+            {{0, size.y}, vertexColor, {0, 1}},
+            {{size.x, size.y}, vertexColor, {1, 1}},
+        }};
+        const std::array<unsigned int, 6> indices = {{
+            0, 2, 1,
+            1, 2, 3
+        }};
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendRenderTarget::getPixelsPerPoint() const
     {
         return m_pixelsPerPoint;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendRenderTarget::getClipRect() const
+    {
+        return m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setDrawCallReorderingEnabled(bool enabled)
+    {
+        flushDeferredDrawCalls();
+        m_drawCallReorderingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isDrawCallReorderingEnabled() const
+    {
+        return m_drawCallReorderingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::deferDrawCall(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+        const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (!m_drawCallReorderingEnabled || m_executingDeferredDrawCalls)
+            return false;
+
+        if (vertexCount == 0)
+            return true;
+
+        // Finding overlapping draw calls takes quadratic time, so we limit how many draw calls are reordered at once
+        constexpr std::size_t maxDeferredDrawCalls = 512;
+        if (m_deferredDrawCalls.size() >= maxDeferredDrawCalls)
+            flushDeferredDrawCalls();
+
+        DeferredDrawCall drawCall;
+        drawCall.texture = texture;
+        drawCall.firstVertex = m_deferredVertices.size();
+        drawCall.vertexCount = vertexCount;
+        drawCall.firstIndex = m_deferredIndices.size();
+        drawCall.indexCount = indices ? indexCount : 0;
+
+        // Textures are sorted in the order in which they were first used, to keep the draw order deterministic
+        drawCall.textureOrder = m_deferredDrawCalls.size();
+        for (const auto& otherDrawCall : m_deferredDrawCalls)
+        {
+            if (otherDrawCall.texture == texture)
+            {
+                drawCall.textureOrder = otherDrawCall.textureOrder;
+                break;
+            }
+        }
+
+        // The vertices are stored with the transformation already applied to them, as we need their bounding box anyway
+        Vector2f minPos{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+        Vector2f maxPos{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+        m_deferredVertices.resize(drawCall.firstVertex + vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            Vertex& vertex = m_deferredVertices[drawCall.firstVertex + i];
+            vertex = vertices[i];
+            vertex.position = states.transform.transformPoint(vertices[i].position);
+
+            minPos.x = std::min(minPos.x, vertex.position.x);
+            minPos.y = std::min(minPos.y, vertex.position.y);
+            maxPos.x = std::max(maxPos.x, vertex.position.x);
+            maxPos.y = std::max(maxPos.y, vertex.position.y);
+        }
+        drawCall.bounds = {minPos.x, minPos.y, maxPos.x - minPos.x, maxPos.y - minPos.y};
+
+        if (indices)
+            m_deferredIndices.insert(m_deferredIndices.end(), indices, indices + indexCount);
+
+        m_deferredDrawCalls.push_back(std::move(drawCall));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::flushDeferredDrawCalls()
+    {
+        if (m_deferredDrawCalls.empty())
+            return;
+
+        // Each draw call is assigned to the lowest layer in which it is still drawn after all draw calls that it overlaps with.
+        // Overlapping draw calls with the same texture may share a layer, as the sorting below keeps their relative order.
+        const std::size_t drawCallCount = m_deferredDrawCalls.size();
+        for (std::size_t i = 0; i < drawCallCount; ++i)
+        {
+            DeferredDrawCall& drawCall = m_deferredDrawCalls[i];
+            drawCall.layer = 0;
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                const DeferredDrawCall& prevDrawCall = m_deferredDrawCalls[j];
+                if (!drawCall.bounds.intersects(prevDrawCall.bounds))
+                    continue;
+
+                if (prevDrawCall.textureOrder == drawCall.textureOrder)
+                    drawCall.layer = std::max(drawCall.layer, prevDrawCall.layer);
+                else
+                    drawCall.layer = std::max(drawCall.layer, prevDrawCall.layer + 1);
+            }
+        }
+
+        m_deferredDrawOrder.resize(drawCallCount);
+        std::iota(m_deferredDrawOrder.begin(), m_deferredDrawOrder.end(), std::size_t(0));
+        std::stable_sort(m_deferredDrawOrder.begin(), m_deferredDrawOrder.end(), [this](std::size_t left, std::size_t right){
+            const DeferredDrawCall& leftDrawCall = m_deferredDrawCalls[left];
+            const DeferredDrawCall& rightDrawCall = m_deferredDrawCalls[right];
+            if (leftDrawCall.layer != rightDrawCall.layer)
+                return leftDrawCall.layer < rightDrawCall.layer;
+            return leftDrawCall.textureOrder < rightDrawCall.textureOrder;
+        });
+
+        m_executingDeferredDrawCalls = true;
+        for (const std::size_t index : m_deferredDrawOrder)
+        {
+            const DeferredDrawCall& drawCall = m_deferredDrawCalls[index];
+            drawVertexArray({}, &m_deferredVertices[drawCall.firstVertex], drawCall.vertexCount,
+                            (drawCall.indexCount > 0) ? &m_deferredIndices[drawCall.firstIndex] : nullptr, drawCall.indexCount,
+                            drawCall.texture);
+        }
+        m_executingDeferredDrawCalls = false;
+
+        m_deferredDrawCalls.clear();
+        m_deferredVertices.clear();
+        m_deferredIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
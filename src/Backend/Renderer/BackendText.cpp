@@ -26,12 +26,120 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <list>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Longer strings are unlikely to be repeated and would make the lookups in the glyph run cache expensive
+        constexpr std::size_t MaxCachedStringLength = 256;
+
+        struct GlyphRunKey
+        {
+            const BackendFont* font = nullptr;
+            unsigned int textureVersion = 0;
+            unsigned int characterSize = 0;
+            unsigned int style = 0;
+            float outlineThickness = 0;
+            Color fillColor;
+            Color outlineColor;
+            String string;
+
+            TGUI_NODISCARD bool operator==(const GlyphRunKey& other) const
+            {
+                return (font == other.font)
+                    && (textureVersion == other.textureVersion)
+                    && (characterSize == other.characterSize)
+                    && (style == other.style)
+                    && (outlineThickness == other.outlineThickness)
+                    && (fillColor == other.fillColor)
+                    && (outlineColor == other.outlineColor)
+                    && (string == other.string);
+            }
+        };
+
+        struct GlyphRunKeyHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const GlyphRunKey& key) const
+            {
+                // FNV-1a hash over the characters, combined with the other properties
+                std::uint64_t hash = 14695981039346656037ull;
+                const auto addValue = [&hash](std::uint64_t value){
+                    hash ^= value;
+                    hash *= 1099511628211ull;
+                };
+
+                for (const char32_t c : key.string)
+                    addValue(c);
+
+                addValue(reinterpret_cast<std::uintptr_t>(key.font));
+                addValue(key.textureVersion);
+                addValue((static_cast<std::uint64_t>(key.characterSize) << 32) | key.style);
+                addValue((static_cast<std::uint64_t>(key.fillColor.getRed()) << 24) | (static_cast<std::uint64_t>(key.fillColor.getGreen()) << 16)
+                         | (static_cast<std::uint64_t>(key.fillColor.getBlue()) << 8) | key.fillColor.getAlpha());
+                return static_cast<std::size_t>(hash);
+            }
+        };
+
+        struct CachedGlyphRun
+        {
+            std::weak_ptr<BackendFont> font; // Used to detect that the font was destroyed and another one reuses its address
+            Vector2f size;
+            std::vector<std::shared_ptr<std::vector<Vertex>>> vertices;
+            std::vector<std::shared_ptr<std::vector<Vertex>>> outlineVertices;
+            std::size_t memoryUsage = 0;
+            std::list<const GlyphRunKey*>::iterator lruPosition;
+        };
+
+        struct GlyphRunCache
+        {
+            std::unordered_map<GlyphRunKey, CachedGlyphRun, GlyphRunKeyHash> runs;
+            std::list<const GlyphRunKey*> lruList; // Most recently used runs are at the front
+            std::size_t memoryUsage = 0;
+            std::size_t memoryLimit = 4 * 1024 * 1024;
+        };
+
+        TGUI_NODISCARD GlyphRunCache& getGlyphRunCache()
+        {
+            static GlyphRunCache cache;
+            return cache;
+        }
+
+        TGUI_NODISCARD GlyphRunKey makeGlyphRunKey(const BackendFont* font, unsigned int textureVersion, unsigned int characterSize, TextStyles style,
+                                                   float outlineThickness, Color fillColor, Color outlineColor, const String& string)
+        {
+            GlyphRunKey key;
+            key.font = font;
+            key.textureVersion = textureVersion;
+            key.characterSize = characterSize;
+            key.style = static_cast<unsigned int>(style);
+            key.outlineThickness = outlineThickness;
+            key.fillColor = fillColor;
+            key.outlineColor = outlineColor;
+            key.string = string;
+            return key;
+        }
+
+        void removeCachedGlyphRun(GlyphRunCache& cache, std::unordered_map<GlyphRunKey, CachedGlyphRun, GlyphRunKeyHash>::iterator it)
+        {
+            cache.memoryUsage -= it->second.memoryUsage;
+            cache.lruList.erase(it->second.lruPosition);
+            cache.runs.erase(it);
+        }
+
+        void evictGlyphRuns(GlyphRunCache& cache)
+        {
+            while ((cache.memoryUsage > cache.memoryLimit) && !cache.lruList.empty())
+                removeCachedGlyphRun(cache, cache.runs.find(*cache.lruList.back()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f BackendText::getSize()
@@ -92,10 +200,21 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
+        TGUI_ASSERT(!m_vertices.empty(), "m_vertices should have already been created if m_verticesNeedUpdate is false");
+        if (loadRecoloredVerticesFromGlyphRunCache())
+            return;
+
+        detachSharedVertices();
+
         const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+        for (const auto& pageVertices : m_vertices)
+        {
+            if (!pageVertices)
+                continue;
+
+            for (auto& vertex : *pageVertices)
+                vertex.color = vertexColor;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,11 +238,19 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        if (m_outlineVertices)
+        if (loadRecoloredVerticesFromGlyphRunCache())
+            return;
+
+        detachSharedVertices();
+
+        const Vertex::Color vertexColor(color);
+        for (const auto& pageVertices : m_outlineVertices)
         {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
+            if (!pageVertices)
+                continue;
+
+            for (auto& vertex : *pageVertices)
+                vertex.color = vertexColor;
         }
     }
 
@@ -199,7 +326,7 @@ namespace tgui
             index = m_string.length();
 
         const bool isBold           = static_cast<unsigned int>(m_style) & TextStyle::Bold;
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+        const float whitespaceWidth = m_font->getAdvance(U' ', m_characterSize, isBold);
         const float lineSpacing     = m_font->getLineSpacing(m_characterSize);
 
         Vector2f position;
@@ -225,7 +352,7 @@ namespace tgui
             }
 
             // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            position.x += m_font->getAdvance(curChar, m_characterSize, isBold);
         }
 
         return position;
@@ -251,17 +378,40 @@ namespace tgui
 
         if (m_verticesNeedUpdate)
         {
-            updateVertices();
+            // Loading glyphs can cause the font to grow or clear one of its pages, in which case the texture coordinates that
+            // were already calculated are no longer correct. The update is repeated a few times to let the atlas settle.
+            for (unsigned int attempt = 0; attempt < 3; ++attempt)
+            {
+                updateVertices();
 
-            // It is possible that the texture changes during the update
-            texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
+                texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
+                if (m_lastFontTextureVersion == textureVersion)
+                    break;
+
+                textureVersion = m_lastFontTextureVersion;
+                m_verticesNeedUpdate = true;
+            }
         }
 
-        if (includeOutline && m_outlineVertices && !m_outlineVertices->empty())
-            data.emplace_back(texture, m_outlineVertices);
+        // The glyphs may be spread over multiple textures, each texture requires a separate draw call
+        const auto addVertexData = [this,&data,&texture](const std::vector<std::shared_ptr<std::vector<Vertex>>>& pages){
+            for (unsigned int page = 0; page < pages.size(); ++page)
+            {
+                if (!pages[page] || pages[page]->empty())
+                    continue;
+
+                unsigned int pageTextureVersion;
+                auto pageTexture = (page == 0) ? texture : m_font->getPageTexture(m_characterSize, page, pageTextureVersion);
+                if (pageTexture)
+                    data.emplace_back(std::move(pageTexture), pages[page]);
+            }
+        };
+
+        if (includeOutline)
+            addVertexData(m_outlineVertices);
 
-        if (includeText && m_vertices && !m_vertices->empty())
-            data.emplace_back(texture, m_vertices);
+        if (includeText)
+            addVertexData(m_vertices);
 
         return data;
     }
@@ -275,15 +425,44 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
-        if (!m_vertices)
-            m_vertices = std::make_shared<std::vector<Vertex>>();
-        if (!m_outlineVertices && (m_outlineThickness != 0))
-            m_outlineVertices = std::make_shared<std::vector<Vertex>>();
+        // Check if another text with the same properties has already created the vertices
+        unsigned int textureVersionBeforeUpdate = 0;
+        const bool useCache = m_font->getTextureVersion(m_characterSize, textureVersionBeforeUpdate);
+        if (useCache && loadVerticesFromGlyphRunCache(textureVersionBeforeUpdate))
+            return;
+
+        // Vertices that are shared with the cache can't be reused, new ones will be created
+        if (m_verticesShared)
+        {
+            m_vertices.clear();
+            m_outlineVertices.clear();
+            m_verticesShared = false;
+        }
+
+        // Returns the vertex array for the page that contains the glyph, creating it if it didn't exist yet
+        const auto getPageVertices = [](std::vector<std::shared_ptr<std::vector<Vertex>>>& pages, unsigned int page) -> std::vector<Vertex>& {
+            if (page >= pages.size())
+                pages.resize(page + 1);
+            if (!pages[page])
+                pages[page] = std::make_shared<std::vector<Vertex>>();
+            return *pages[page];
+        };
 
         m_size = {0, 0};
-        m_vertices->clear();
-        if (m_outlineVertices)
-            m_outlineVertices->clear();
+        for (const auto& pageVertices : m_vertices)
+        {
+            if (pageVertices)
+                pageVertices->clear();
+        }
+        for (const auto& pageVertices : m_outlineVertices)
+        {
+            if (pageVertices)
+                pageVertices->clear();
+        }
+
+        // Underlines and strike-through lines use the white pixels on the first page
+        std::vector<Vertex>& lineVertices = getPageVertices(m_vertices, 0);
+        std::vector<Vertex>* lineOutlineVertices = (m_outlineThickness != 0) ? &getPageVertices(m_outlineVertices, 0) : nullptr;
 
         if (m_characterSize == 0)
             return;
@@ -306,7 +485,7 @@ namespace tgui
         const float strikeThroughOffset = isStrikeThrough ? (xBounds.top + (xBounds.height / 2.f)) : 0.f;
 
         // Precompute the variables needed by the algorithm
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+        const float whitespaceWidth = m_font->getAdvance(U' ', m_characterSize, isBold);
         const float lineSpacing = m_font->getLineSpacing(m_characterSize);
         float x = m_outlineThickness;
         float y = m_font->getAscent(m_characterSize) + m_outlineThickness;
@@ -327,19 +506,19 @@ namespace tgui
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+                addLine(lineVertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*lineOutlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             // If we're using the strike through style and there's a new line, draw a line across all characters
             if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+                addLine(lineVertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*lineOutlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             prevChar = curChar;
@@ -373,7 +552,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(getPageVertices(m_outlineVertices, glyph.page), {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -381,7 +560,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(getPageVertices(m_vertices, glyph.page), {x, y}, vertexFillColor, glyph, fontScale, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -396,19 +575,19 @@ namespace tgui
         // If we're using the underlined style, add the last line
         if (isUnderlined && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+            addLine(lineVertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*lineOutlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // If we're using the strike through style, add the last line across all characters
         if (isStrikeThrough && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+            addLine(lineVertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*lineOutlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // The height of a line can sometimes be slightly larger than the line spacing returned by the font.
@@ -418,27 +597,157 @@ namespace tgui
 
         m_size = {maxX + m_outlineThickness, height + 2 * m_outlineThickness};
 
-        // Normalize the texture coordinates
-        const Vector2u textureSize = m_font->getTextureSize(m_characterSize);
-        if ((textureSize.x > 0) && (textureSize.y > 0))
+        // Normalize the texture coordinates, each page can have a different texture size
+        for (const auto* pages : {&m_vertices, &m_outlineVertices})
         {
-            const float textureWidth = static_cast<float>(textureSize.x);
-            const float textureHeight = static_cast<float>(textureSize.y);
-
-            for (auto& vertex : *m_vertices)
+            for (unsigned int page = 0; page < pages->size(); ++page)
             {
-                vertex.texCoords.x /= textureWidth;
-                vertex.texCoords.y /= textureHeight;
-            }
-            if (m_outlineVertices)
-            {
-                for (auto& vertex : *m_outlineVertices)
+                if (!(*pages)[page] || (*pages)[page]->empty())
+                    continue;
+
+                const Vector2u textureSize = m_font->getPageTextureSize(m_characterSize, page);
+                if ((textureSize.x == 0) || (textureSize.y == 0))
+                    continue;
+
+                const float textureWidth = static_cast<float>(textureSize.x);
+                const float textureHeight = static_cast<float>(textureSize.y);
+                for (auto& vertex : *(*pages)[page])
                 {
                     vertex.texCoords.x /= textureWidth;
                     vertex.texCoords.y /= textureHeight;
                 }
             }
         }
+
+        // Store the vertices in the cache, unless loading the glyphs changed the texture coordinates of existing glyphs
+        unsigned int textureVersionAfterUpdate = 0;
+        if (useCache && m_font->getTextureVersion(m_characterSize, textureVersionAfterUpdate)
+         && (textureVersionAfterUpdate == textureVersionBeforeUpdate))
+        {
+            storeVerticesInGlyphRunCache(textureVersionAfterUpdate);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendText::loadVerticesFromGlyphRunCache(unsigned int textureVersion)
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        if ((cache.memoryLimit == 0) || (m_string.length() > MaxCachedStringLength))
+            return false;
+
+        const auto it = cache.runs.find(makeGlyphRunKey(m_font.get(), textureVersion, m_characterSize, m_style, m_outlineThickness, m_fillColor, m_outlineColor, m_string));
+        if (it == cache.runs.end())
+            return false;
+
+        if (it->second.font.lock() != m_font)
+        {
+            removeCachedGlyphRun(cache, it);
+            return false;
+        }
+
+        cache.lruList.splice(cache.lruList.begin(), cache.lruList, it->second.lruPosition);
+
+        m_size = it->second.size;
+        m_vertices = it->second.vertices;
+        m_outlineVertices = it->second.outlineVertices;
+        m_verticesShared = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::storeVerticesInGlyphRunCache(unsigned int textureVersion)
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        if ((cache.memoryLimit == 0) || (m_string.length() > MaxCachedStringLength))
+            return;
+
+        CachedGlyphRun run;
+        run.font = m_font;
+        run.size = m_size;
+        run.vertices = m_vertices;
+        run.outlineVertices = m_outlineVertices;
+        run.memoryUsage = sizeof(CachedGlyphRun) + sizeof(GlyphRunKey) + (m_string.length() * sizeof(char32_t));
+        for (const auto* pages : {&m_vertices, &m_outlineVertices})
+        {
+            for (const auto& pageVertices : *pages)
+            {
+                if (pageVertices)
+                    run.memoryUsage += pageVertices->size() * sizeof(Vertex);
+            }
+        }
+
+        const auto insertResult = cache.runs.emplace(makeGlyphRunKey(m_font.get(), textureVersion, m_characterSize, m_style, m_outlineThickness, m_fillColor, m_outlineColor, m_string), std::move(run));
+        if (!insertResult.second)
+            return;
+
+        cache.lruList.push_front(&insertResult.first->first);
+        insertResult.first->second.lruPosition = cache.lruList.begin();
+        cache.memoryUsage += insertResult.first->second.memoryUsage;
+        m_verticesShared = true;
+        evictGlyphRuns(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendText::loadRecoloredVerticesFromGlyphRunCache()
+    {
+        // Vertices that aren't shared can simply be recolored in place
+        if (!m_verticesShared || !m_font)
+            return false;
+
+        // Another text may already have the same vertices with the new colors, in which case they don't have to be copied
+        unsigned int textureVersion = 0;
+        if (!m_font->getTextureVersion(m_characterSize, textureVersion))
+            return false;
+
+        return loadVerticesFromGlyphRunCache(textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::detachSharedVertices()
+    {
+        if (!m_verticesShared)
+            return;
+
+        for (auto* pages : {&m_vertices, &m_outlineVertices})
+        {
+            for (auto& pageVertices : *pages)
+            {
+                if (pageVertices)
+                    pageVertices = std::make_shared<std::vector<Vertex>>(*pageVertices);
+            }
+        }
+
+        m_verticesShared = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::setGlyphRunCacheMemoryLimit(std::size_t bytes)
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        cache.memoryLimit = bytes;
+        evictGlyphRuns(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendText::getGlyphRunCacheMemoryLimit()
+    {
+        return getGlyphRunCache().memoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::clearGlyphRunCache()
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        cache.runs.clear();
+        cache.lruList.clear();
+        cache.memoryUsage = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,10 +756,14 @@ namespace tgui
     {
         const float padding = 1;
 
-        const float left   = glyph.bounds.left - padding / fontScale;
-        const float top    = glyph.bounds.top - padding / fontScale;
-        const float right  = glyph.bounds.left + glyph.bounds.width + padding / fontScale;
-        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding / fontScale;
+        // Size of a texel in text coordinates. This is normally the inverse of the font scale, but fonts that render glyphs
+        // at a fixed size (e.g. as distance fields) stretch the texture rect over bounds of a different size.
+        const float texelSize = (glyph.textureRect.width > 0) ? (glyph.bounds.width / glyph.textureRect.width) : (1 / fontScale);
+
+        const float left   = glyph.bounds.left - padding * texelSize;
+        const float top    = glyph.bounds.top - padding * texelSize;
+        const float right  = glyph.bounds.left + glyph.bounds.width + padding * texelSize;
+        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding * texelSize;
 
         const float u1 = glyph.textureRect.left - padding;
         const float v1 = glyph.textureRect.top - padding;
@@ -24,6 +24,10 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -55,6 +59,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(pixels, "updateRegion in BackendTexture doesn't accept a nullptr for pixels");
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "updateRegion in BackendTexture requires the region to lie inside the texture");
+
+        if (m_pixels)
+        {
+            for (unsigned int y = 0; y < region.height; ++y)
+            {
+                std::memcpy(&m_pixels[(((region.top + y) * m_imageSize.x) + region.left) * 4],
+                            &pixels[y * region.width * 4], region.width * 4);
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -76,6 +100,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTexture::setDistanceField(bool distanceField)
+    {
+        m_isDistanceField = distanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isDistanceField() const
+    {
+        return m_isDistanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
         if (!m_pixels)
@@ -32,6 +32,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
     #include <numeric>
 #endif
 
@@ -41,6 +42,12 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct BackendRenderTargetGLES2::StreamBuffer : priv::StreamBufferOpenGL
+    {
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static GLuint createShaderProgram()
     {
         // Select the vertex and fragment shaders based on which GLES version is available.
@@ -66,11 +73,17 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uDistanceField) {\n"
+                "        float smoothing = max(fwidth(texColor.a) * 0.5, 0.001);\n"
+                "        texColor.a = smoothstep(0.502 - smoothing, 0.502 + smoothing, texColor.a);\n"
+                "    }\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -92,11 +105,17 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uDistanceField) {\n"
+                "        float smoothing = max(fwidth(texColor.a) * 0.5, 0.001);\n"
+                "        texColor.a = smoothstep(0.502 - smoothing, 0.502 + smoothing, texColor.a);\n"
+                "    }\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -114,15 +133,44 @@ namespace tgui
                 "    color = inColor;\n"
                 "    texCoord = inTexCoord;\n"
                 "}";
-            fragmentShaderSource =
-                "#version 100\n"
-                "precision mediump float;\n"
-                "uniform sampler2D uTexture;\n"
-                "varying vec4 color;\n"
-                "varying vec2 texCoord;\n"
-                "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
-                "}";
+
+            // Derivatives are optional in GLES 2. Without them, the edges of distance fields are smoothed by a fixed amount.
+            const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+            if (extensions && std::strstr(extensions, "GL_OES_standard_derivatives"))
+            {
+                fragmentShaderSource =
+                    "#version 100\n"
+                    "#extension GL_OES_standard_derivatives : enable\n"
+                    "precision mediump float;\n"
+                    "uniform sampler2D uTexture;\n"
+                    "uniform bool uDistanceField;\n"
+                    "varying vec4 color;\n"
+                    "varying vec2 texCoord;\n"
+                    "void main() {\n"
+                    "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                    "    if (uDistanceField) {\n"
+                    "        float smoothing = max(fwidth(texColor.a) * 0.5, 0.001);\n"
+                    "        texColor.a = smoothstep(0.502 - smoothing, 0.502 + smoothing, texColor.a);\n"
+                    "    }\n"
+                    "    gl_FragColor = texColor * color;\n"
+                    "}";
+            }
+            else
+            {
+                fragmentShaderSource =
+                    "#version 100\n"
+                    "precision mediump float;\n"
+                    "uniform sampler2D uTexture;\n"
+                    "uniform bool uDistanceField;\n"
+                    "varying vec4 color;\n"
+                    "varying vec2 texCoord;\n"
+                    "void main() {\n"
+                    "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                    "    if (uDistanceField)\n"
+                    "        texColor.a = smoothstep(0.402, 0.602, texColor.a);\n"
+                    "    gl_FragColor = texColor * color;\n"
+                    "}";
+            }
         }
 
         // Create the vertex shader
@@ -187,6 +235,8 @@ namespace tgui
                 throw Exception{U"Failed to initialize BackendRenderTargetGLES2: projectionMatrix uniform wasn't found in shader program"};
         }
 
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             const int positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -204,6 +254,9 @@ namespace tgui
             m_texCoordShaderLocation = static_cast<GLuint>(texCoordShaderLocation);
         }
 
+        m_vertexStreamBuffer = std::make_unique<StreamBuffer>();
+        m_indexStreamBuffer = std::make_unique<StreamBuffer>();
+
         createBuffers();
 
         // Create a solid white 1x1 texture to pass to the shader when we aren't drawing a texture
@@ -223,6 +276,9 @@ namespace tgui
 
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
+
+        if (m_backBufferFrameBuffer)
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_backBufferFrameBuffer));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,9 +364,46 @@ namespace tgui
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, 0));
+        m_distanceFieldTextureBound = false;
+
+        // When only part of the gui is redrawn, we render to an offscreen framebuffer that still contains the previous frame
+        GLint oldDrawFrameBuffer = 0;
+        GLint oldReadFrameBuffer = 0;
+        if (m_redrawRegion)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &oldDrawFrameBuffer));
+            TGUI_GL_CHECK(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldReadFrameBuffer));
+
+            if (!prepareBackBuffer())
+                m_redrawRegion = m_viewRect;
+
+            // Only the damaged region is cleared and redrawn, widgets outside it are skipped by drawWidget
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFrameBuffer));
+            addClippingLayer({}, *m_redrawRegion);
+            TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        }
 
         // Draw the widgets
-        root->draw(*this, {});
+        m_uploadedByteCount = 0;
+        if (!m_redrawRegion || ((m_redrawRegion->width > 0) && (m_redrawRegion->height > 0)))
+            root->draw(*this, {});
+
+        if (m_redrawRegion)
+            removeClippingLayer();
+
+        flushDeferredDrawCalls();
+
+        if (m_redrawRegion)
+        {
+            // Copy the entire gui from the offscreen framebuffer to the framebuffer that was bound when this function was called
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_backBufferFrameBuffer));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(oldDrawFrameBuffer)));
+            TGUI_GL_CHECK(glBlitFramebuffer(viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            GL_COLOR_BUFFER_BIT, GL_NEAREST));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(oldReadFrameBuffer)));
+        }
 
         m_currentTexture = nullptr;
 
@@ -343,9 +436,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetGLES2::drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region)
+    {
+        // Copying the offscreen framebuffer requires glBlitFramebuffer, which isn't available in OpenGL ES 2.0
+        if (!TGUI_GLAD_GL_ES_VERSION_3_0)
+        {
+            drawGui(root);
+            return;
+        }
+
+        m_redrawRegion = region;
+        drawGui(root);
+        m_redrawRegion.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetGLES2::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
+        if (deferDrawCall(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
         // Change the bound texture if it changed
         if (m_currentTexture != texture)
         {
@@ -361,12 +473,20 @@ namespace tgui
                 m_currentTexture = nullptr;
                 TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
             }
+
+            // The shader has to know whether the texture contains a distance field, the uniform is only updated when this changes
+            const bool distanceField = texture && texture->isDistanceField();
+            if (m_distanceFieldTextureBound != distanceField)
+            {
+                TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, distanceField ? 1 : 0));
+                m_distanceFieldTextureBound = distanceField;
+            }
         }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+        // Load the data into the vertex buffer. There is no base vertex parameter in the draw calls before GLES 3.2,
+        // so the attributes are changed to point to the uploaded vertices instead.
+        const std::size_t vertexOffset = uploadToStreamBuffer(*m_vertexStreamBuffer, GL_ARRAY_BUFFER, vertices, vertexCount * sizeof(Vertex), sizeof(Vertex));
+        setVertexAttribs(vertexOffset);
 
         const Transform finalTransform = m_projectionTransform * states.transform;
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
@@ -374,9 +494,9 @@ namespace tgui
         if (indices)
         {
             // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+            const std::size_t indexOffset = uploadToStreamBuffer(*m_indexStreamBuffer, GL_ELEMENT_ARRAY_BUFFER, indices, indexCount * sizeof(GLuint), sizeof(GLuint));
 
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, reinterpret_cast<GLvoid*>(indexOffset)));
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
             TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
@@ -384,6 +504,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t BackendRenderTargetGLES2::getUploadedByteCount() const
+    {
+        return m_uploadedByteCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetGLES2::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
@@ -403,19 +530,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetGLES2::setVertexAttribs()
+    void BackendRenderTargetGLES2::setVertexAttribs(std::size_t offset)
     {
-        TGUI_GL_CHECK(glEnableVertexAttribArray(m_positionShaderLocation));
-        TGUI_GL_CHECK(glEnableVertexAttribArray(m_colorShaderLocation));
-        TGUI_GL_CHECK(glEnableVertexAttribArray(m_texCoordShaderLocation));
-
         // Position is stored as x,y in the first 2 floats
         // Color is stored as r,g,b,a in the next 4 bytes
         // Texture coordinate is stored as u,v in the last 2 floats
         static_assert(sizeof(Vertex) == 8 + 4 + 8, "Size of tgui::Vertex has to match the data");
-        TGUI_GL_CHECK(glVertexAttribPointer(m_positionShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
-        TGUI_GL_CHECK(glVertexAttribPointer(m_colorShaderLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
-        TGUI_GL_CHECK(glVertexAttribPointer(m_texCoordShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        TGUI_GL_CHECK(glVertexAttribPointer(m_positionShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(offset)));
+        TGUI_GL_CHECK(glVertexAttribPointer(m_colorShaderLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(offset + 8)));
+        TGUI_GL_CHECK(glVertexAttribPointer(m_texCoordShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(offset + 8 + 4)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetGLES2::uploadToStreamBuffer(StreamBuffer& stream, unsigned int target, const void* data,
+                                                              std::size_t dataSize, std::size_t alignment)
+    {
+        m_uploadedByteCount += dataSize;
+        return stream.upload(target, data, dataSize, alignment, (TGUI_GLAD_GL_ES_VERSION_3_0 != 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::prepareBackBuffer()
+    {
+        const Vector2u size{static_cast<unsigned int>(m_targetSize.x), static_cast<unsigned int>(m_targetSize.y)};
+        if (m_backBufferFrameBuffer && m_backBufferTexture && (m_backBufferTexture->getSize() == size))
+            return true;
+
+        if (!m_backBufferTexture)
+            m_backBufferTexture = std::make_unique<BackendTextureGLES2>();
+        m_backBufferTexture->loadTextureOnly(size, nullptr, false);
+
+        if (!m_backBufferFrameBuffer)
+            TGUI_GL_CHECK(glGenFramebuffers(1, &m_backBufferFrameBuffer));
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFrameBuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_backBufferTexture->getInternalTexture(), 0));
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,7 +588,10 @@ namespace tgui
         TGUI_GL_CHECK(glGenBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
-        setVertexAttribs();
+        TGUI_GL_CHECK(glEnableVertexAttribArray(m_positionShaderLocation));
+        TGUI_GL_CHECK(glEnableVertexAttribArray(m_colorShaderLocation));
+        TGUI_GL_CHECK(glEnableVertexAttribArray(m_texCoordShaderLocation));
+        setVertexAttribs(0);
 
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glBindVertexArray(0));
@@ -28,6 +28,10 @@ module;
 #include <TGUI/Config.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <array>
+    #include <cstddef>
+    #include <cstring>
     #include <string>
 
     // Included by glad/gl.h
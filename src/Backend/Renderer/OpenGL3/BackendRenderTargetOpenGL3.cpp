@@ -32,6 +32,9 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
+    #include <cstddef>
     #include <numeric>
 #endif
 
@@ -41,6 +44,56 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct BackendRenderTargetOpenGL3::StreamBuffer : priv::StreamBufferOpenGL
+    {
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint linkShaderProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource)
+    {
+        // Create the vertex shader
+        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        if (vertexShader == 0)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_VERTEX_SHADER) returned 0."};
+
+        TGUI_GL_CHECK(glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr));
+        TGUI_GL_CHECK(glCompileShader(vertexShader));
+
+        GLint vertexShaderCompiled = GL_FALSE;
+        TGUI_GL_CHECK(glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexShaderCompiled));
+        if (vertexShaderCompiled != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile vertex shader."};
+
+        // Create the fragment shader
+        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        if (fragmentShader == 0)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_FRAGMENT_SHADER) returned 0."};
+
+        TGUI_GL_CHECK(glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr));
+        TGUI_GL_CHECK(glCompileShader(fragmentShader));
+
+        GLint fragmentShaderCompiled = GL_FALSE;
+        TGUI_GL_CHECK(glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentShaderCompiled));
+        if (fragmentShaderCompiled != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile fragment shader."};
+
+        // Link the vertex and fragment shader into a program
+        GLuint programId = glCreateProgram();
+        TGUI_GL_CHECK(glAttachShader(programId, vertexShader));
+        TGUI_GL_CHECK(glAttachShader(programId, fragmentShader));
+        TGUI_GL_CHECK(glLinkProgram(programId));
+
+        GLint programLinked = GL_TRUE;
+        TGUI_GL_CHECK(glGetProgramiv(programId, GL_LINK_STATUS, &programLinked));
+        if (programLinked != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to link the shaders."};
+
+        return programId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static GLuint createShaderProgram()
     {
         const GLchar* vertexShaderSource;
@@ -77,62 +130,112 @@ namespace tgui
                 "}";
         }
 
+        // When the texture contains a distance field (e.g. glyphs), the edge lies where the alpha channel is halfway.
+        // The edge is anti-aliased over the width of a single pixel on the screen, no matter how much the texture is scaled.
         const GLchar* fragmentShaderSource =
         {
             "#version 330 core\n"
             "uniform sampler2D uTexture;\n"
+            "uniform bool uDistanceField;\n"
             "in vec4 color;\n"
             "in vec2 texCoord;\n"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            "    vec4 texColor = texture(uTexture, texCoord);\n"
+            "    if (uDistanceField) {\n"
+            "        float smoothing = max(fwidth(texColor.a) * 0.5, 0.001);\n"
+            "        texColor.a = smoothstep(0.502 - smoothing, 0.502 + smoothing, texColor.a);\n"
+            "    }\n"
+            "    outColor = texColor * color;\n"
             "}"
         };
 
-        // Create the vertex shader
-        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-        if (vertexShader == 0)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_VERTEX_SHADER) returned 0."};
-
-        TGUI_GL_CHECK(glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr));
-        TGUI_GL_CHECK(glCompileShader(vertexShader));
-
-        GLint vertexShaderCompiled = GL_FALSE;
-        TGUI_GL_CHECK(glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexShaderCompiled));
-        if (vertexShaderCompiled != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile vertex shader."};
-
-        // Create the fragment shader
-        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-        if (fragmentShader == 0)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_FRAGMENT_SHADER) returned 0."};
-
-        TGUI_GL_CHECK(glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr));
-        TGUI_GL_CHECK(glCompileShader(fragmentShader));
+        return linkShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
 
-        GLint fragmentShaderCompiled = GL_FALSE;
-        TGUI_GL_CHECK(glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentShaderCompiled));
-        if (fragmentShaderCompiled != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile fragment shader."};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Link the vertex and fragment shader into a program
-        GLuint programId = glCreateProgram();
-        TGUI_GL_CHECK(glAttachShader(programId, vertexShader));
-        TGUI_GL_CHECK(glAttachShader(programId, fragmentShader));
-        TGUI_GL_CHECK(glLinkProgram(programId));
+    TGUI_NODISCARD static GLuint createQuadShaderProgram()
+    {
+        // Every instance stretches the unit quad to its rectangle and applies its own transformation
+        const GLchar* vertexShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform mat4 projectionMatrix;\n"
+            "layout(location=0) in vec2 inCorner;\n"
+            "layout(location=1) in vec4 inRect;\n"
+            "layout(location=2) in vec4 inTexRect;\n"
+            "layout(location=3) in vec3 inTransformX;\n"
+            "layout(location=4) in vec3 inTransformY;\n"
+            "layout(location=5) in vec4 inBorders;\n"
+            "layout(location=6) in float inRadius;\n"
+            "layout(location=7) in vec4 inColor;\n"
+            "layout(location=8) in vec4 inBorderColor;\n"
+            "out vec2 localPos;\n"
+            "out vec2 texCoord;\n"
+            "flat out vec2 size;\n"
+            "flat out vec4 borders;\n"
+            "flat out float radius;\n"
+            "flat out vec4 color;\n"
+            "flat out vec4 borderColor;\n"
+            "void main() {\n"
+            "    vec3 pos = vec3(inRect.xy + inCorner * inRect.zw, 1);\n"
+            "    gl_Position = projectionMatrix * vec4(dot(inTransformX, pos), dot(inTransformY, pos), 0, 1);\n"
+            "    localPos = inCorner * inRect.zw;\n"
+            "    texCoord = mix(inTexRect.xy, inTexRect.zw, inCorner);\n"
+            "    size = inRect.zw;\n"
+            "    borders = inBorders;\n"
+            "    radius = inRadius;\n"
+            "    color = inColor;\n"
+            "    borderColor = inBorderColor;\n"
+            "}"
+        };
 
-        GLint programLinked = GL_TRUE;
-        TGUI_GL_CHECK(glGetProgramiv(programId, GL_LINK_STATUS, &programLinked));
-        if (programLinked != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to link the shaders."};
+        // The borders and rounded corners are calculated per pixel. Only the rounded corners are anti-aliased, the straight
+        // edges are aligned to pixels and should look identical to what we would get when drawing triangles.
+        const GLchar* fragmentShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform sampler2D uTexture;\n"
+            "in vec2 localPos;\n"
+            "in vec2 texCoord;\n"
+            "flat in vec2 size;\n"
+            "flat in vec4 borders;\n"
+            "flat in float radius;\n"
+            "flat in vec4 color;\n"
+            "flat in vec4 borderColor;\n"
+            "out vec4 outColor;\n"
+            "float roundedRectDistance(vec2 pos, vec2 halfSize, float r) {\n"
+            "    vec2 q = abs(pos) - halfSize + vec2(r);\n"
+            "    return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;\n"
+            "}\n"
+            "void main() {\n"
+            "    vec4 fillColor = texture(uTexture, texCoord) * color;\n"
+            "    if (radius <= 0.0) {\n"
+            "        bool insideBorders = all(greaterThanEqual(localPos, borders.xy)) && all(lessThanEqual(localPos, size - borders.zw));\n"
+            "        outColor = insideBorders ? fillColor : borderColor;\n"
+            "        return;\n"
+            "    }\n"
+            "    float pixelSize = length(fwidth(localPos)) * 0.7071;\n"
+            "    vec2 halfSize = size * 0.5;\n"
+            "    float outerCoverage = clamp(0.5 - roundedRectDistance(localPos - halfSize, halfSize, radius) / pixelSize, 0.0, 1.0);\n"
+            "    vec2 innerHalfSize = max((size - borders.xy - borders.zw) * 0.5, vec2(0.0));\n"
+            "    float innerRadius = min(max(radius - borders.x, 0.0), min(innerHalfSize.x, innerHalfSize.y));\n"
+            "    float innerDistance = roundedRectDistance(localPos - borders.xy - innerHalfSize, innerHalfSize, innerRadius);\n"
+            "    float innerCoverage = clamp(0.5 - innerDistance / pixelSize, 0.0, 1.0);\n"
+            "    vec4 result = mix(borderColor, fillColor, innerCoverage);\n"
+            "    outColor = vec4(result.rgb, result.a * outerCoverage);\n"
+            "}"
+        };
 
-        return programId;
+        return linkShaderProgram(vertexShaderSource, fragmentShaderSource);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendRenderTargetOpenGL3::BackendRenderTargetOpenGL3() :
-        m_shaderProgram(createShaderProgram())
+        m_shaderProgram(createShaderProgram()),
+        m_quadShaderProgram(createQuadShaderProgram())
     {
         TGUI_ASSERT(isBackendSet(), "BackendRenderTargetOpenGL3 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendRenderTargetOpenGL3 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
@@ -141,7 +244,15 @@ namespace tgui
         if (!TGUI_GLAD_GL_VERSION_4_3)
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
 
+        m_quadProjectionMatrixShaderUniformLocation = glGetUniformLocation(m_quadShaderProgram, "projectionMatrix");
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
+        m_vertexStreamBuffer = std::make_unique<StreamBuffer>();
+        m_indexStreamBuffer = std::make_unique<StreamBuffer>();
+        m_quadInstanceStreamBuffer = std::make_unique<StreamBuffer>();
+
         createBuffers();
+        createQuadBuffers();
 
         // Create a solid white 1x1 texture to pass to the shader when we aren't drawing a texture
         m_emptyTexture = std::make_unique<BackendTextureOpenGL3>();
@@ -158,6 +269,16 @@ namespace tgui
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
+
+        TGUI_GL_CHECK(glDeleteBuffers(1, &m_quadVertexBuffer));
+        TGUI_GL_CHECK(glDeleteBuffers(1, &m_quadInstanceBuffer));
+        TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_quadVertexArray));
+        TGUI_GL_CHECK(glDeleteProgram(m_quadShaderProgram));
+
+        if (m_backBufferFrameBuffer)
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_backBufferFrameBuffer));
+        if (m_renderLayerFrameBuffer)
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_renderLayerFrameBuffer));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +355,7 @@ namespace tgui
                                                static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        m_scissorRect = viewportGL;
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
         TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
@@ -242,9 +364,50 @@ namespace tgui
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, 0));
+        m_distanceFieldTextureBound = false;
+
+        // When only part of the gui is redrawn, we render to an offscreen framebuffer that still contains the previous frame
+        GLint oldDrawFrameBuffer = 0;
+        GLint oldReadFrameBuffer = 0;
+        if (m_redrawRegion)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &oldDrawFrameBuffer));
+            TGUI_GL_CHECK(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldReadFrameBuffer));
+
+            if (!prepareBackBuffer())
+                m_redrawRegion = m_viewRect;
+
+            // Only the damaged region is cleared and redrawn, widgets outside it are skipped by drawWidget
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFrameBuffer));
+            addClippingLayer({}, *m_redrawRegion);
+            TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        }
 
         // Draw the widgets
-        root->draw(*this, {});
+        m_uploadedByteCount = 0;
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        if (!m_redrawRegion || ((m_redrawRegion->width > 0) && (m_redrawRegion->height > 0)))
+            root->draw(*this, {});
+
+        if (m_redrawRegion)
+            removeClippingLayer();
+
+        flushDeferredDrawCalls();
+        flushBatch();
+        TGUI_ASSERT(m_renderLayers.empty(), "Each call to beginRenderToTexture needs to be followed by a call to endRenderToTexture");
+
+        if (m_redrawRegion)
+        {
+            // Copy the entire gui from the offscreen framebuffer to the framebuffer that was bound when this function was called
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_backBufferFrameBuffer));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(oldDrawFrameBuffer)));
+            TGUI_GL_CHECK(glBlitFramebuffer(viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            GL_COLOR_BUFFER_BIT, GL_NEAREST));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(oldReadFrameBuffer)));
+        }
 
         m_currentTexture = nullptr;
 
@@ -276,62 +439,542 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region)
+    {
+        m_redrawRegion = region;
+        drawGui(root);
+        m_redrawRegion.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
+        if (deferDrawCall(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
+        if (!m_batchingEnabled)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+            bindTexture(texture);
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
-            }
-            else
+            // Load the data into the vertex buffer
+            const std::size_t vertexOffset = uploadToStreamBuffer(*m_vertexStreamBuffer, GL_ARRAY_BUFFER, vertices, vertexCount * sizeof(Vertex), sizeof(Vertex));
+            const auto baseVertex = static_cast<GLint>(vertexOffset / sizeof(Vertex));
+
+            const Transform finalTransform = m_projectionTransform * states.transform;
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
+
+            if (indices)
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                // Load the data into the index buffer
+                const std::size_t indexOffset = uploadToStreamBuffer(*m_indexStreamBuffer, GL_ELEMENT_ARRAY_BUFFER, indices, indexCount * sizeof(GLuint), sizeof(GLuint));
+
+                TGUI_GL_CHECK(glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT,
+                                                       reinterpret_cast<GLvoid*>(indexOffset), baseVertex));
             }
+            else // No indices were given, all vertices need to be drawn in the order they were provided
+                TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, baseVertex, static_cast<GLsizei>(vertexCount)));
+
+            return;
         }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+        // The vertices can only be added to the current batch if they use the same texture
+        if (m_currentTexture != texture)
+        {
+            flushBatch();
+            bindTexture(texture);
+        }
 
-        const Transform finalTransform = m_projectionTransform * states.transform;
-        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
+        // Don't let the batch grow indefinitely, the buffers on the GPU would otherwise become unnecessarily large.
+        // Quads that were drawn with the instanced pipeline also need to be drawn first to keep the correct drawing order.
+        constexpr std::size_t maxBatchVertexCount = 65536;
+        if ((!m_batchVertices.empty() && (m_batchVertices.size() + vertexCount > maxBatchVertexCount)) || !m_quadInstances.empty())
+            flushBatch();
+
+        // The transformation is applied on the CPU, so that all vertices in the batch can be drawn with the same projection matrix
+        const std::size_t firstVertex = m_batchVertices.size();
+        const auto& matrix = states.transform.getMatrix();
+        m_batchVertices.resize(firstVertex + vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            Vertex& vertex = m_batchVertices[firstVertex + i];
+            vertex = vertices[i];
+            vertex.position = {matrix[0] * vertices[i].position.x + matrix[4] * vertices[i].position.y + matrix[12],
+                               matrix[1] * vertices[i].position.x + matrix[5] * vertices[i].position.y + matrix[13]};
+        }
 
+        const auto indexOffset = static_cast<unsigned int>(firstVertex);
         if (indices)
         {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
-
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+            const std::size_t firstIndex = m_batchIndices.size();
+            m_batchIndices.resize(firstIndex + indexCount);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices[firstIndex + i] = indices[i] + indexOffset;
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
-            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+        {
+            const std::size_t firstIndex = m_batchIndices.size();
+            m_batchIndices.resize(firstIndex + vertexCount);
+            std::iota(m_batchIndices.begin() + static_cast<std::ptrdiff_t>(firstIndex), m_batchIndices.end(), indexOffset);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
+    {
+        if (!canDrawQuadInstances())
+        {
+            BackendRenderTarget::drawBorders(states, borders, size, color);
+            return;
+        }
+
+        // The inside of the quad is filled with a transparent color
+        addQuadInstance(states.transform, {{}, size}, {}, Vertex::Color{0, 0, 0, 0}, borders, Vertex::Color(color), 0, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawFilledRect(const RenderStates& states, Vector2f size, Color color)
+    {
+        if (!canDrawQuadInstances())
+        {
+            BackendRenderTarget::drawFilledRect(states, size, color);
+            return;
+        }
+
+        const Vertex::Color vertexColor(color);
+        addQuadInstance(states.transform, {{}, size}, {}, vertexColor, {0}, vertexColor, 0, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        // Only sprites that consist of a single quad are drawn with the instanced pipeline
+        if (!sprite.isSet() || !canDrawQuadInstances() || (sprite.getScalingType() != Sprite::ScalingType::Normal)
+         || (sprite.getRotation() != 0) || (sprite.getVisibleRect() != FloatRect{}) || (sprite.getVertices().size() != 4))
+        {
+            BackendRenderTarget::drawSprite(states, sprite);
+            return;
+        }
+
+        std::shared_ptr<BackendTexture> backendTexture;
+        if (sprite.getTexture().getData()->svgImage)
+            backendTexture = sprite.getSvgTexture();
+        else
+            backendTexture = sprite.getTexture().getData()->backendTexture;
+
+        // Vertex 0 is the top left corner and vertex 3 is the bottom right corner of the sprite
+        const auto& vertices = sprite.getVertices();
+        const Vector2f position = sprite.getPosition() + vertices[0].position;
+        const FloatRect texRect{vertices[0].texCoords, vertices[3].texCoords - vertices[0].texCoords};
+        addQuadInstance(states.transform, {position, vertices[3].position - vertices[0].position}, texRect,
+                        vertices[0].color, {0}, vertices[0].color, 0, backendTexture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor,
+                                                          float radius, const Borders& borders, const Color& borderColor)
+    {
+        if (!canDrawQuadInstances())
+        {
+            BackendRenderTarget::drawRoundedRectangle(states, size, backgroundColor, radius, borders, borderColor);
+            return;
+        }
+
+        // Radius can never be larger than half the width or height
+        radius = std::max(0.f, std::min({radius, size.x / 2, size.y / 2}));
+
+        // Just like in the base class, the left border is used on all sides
+        const float borderWidth = std::max(0.f, borders.getLeft());
+        const Vertex::Color vertexColor(backgroundColor);
+        addQuadInstance(states.transform, {{}, size}, {}, vertexColor, {borderWidth},
+                        (borderWidth > 0) ? Vertex::Color(borderColor) : vertexColor, radius, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::beginRenderToTexture(std::shared_ptr<BackendTexture>& texture, Vector2f size)
+    {
+        const Vector2u textureSize{static_cast<unsigned int>(std::ceil(size.x * m_pixelsPerPoint.x)),
+                                   static_cast<unsigned int>(std::ceil(size.y * m_pixelsPerPoint.y))};
+        if ((textureSize.x == 0) || (textureSize.y == 0))
+            return false;
+
+        // Everything that was drawn so far still has to end up in the framebuffer that is currently bound
+        flushDeferredDrawCalls();
+        flushBatch();
+
+        auto textureGL = std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture);
+        if (!textureGL || (textureGL->getSize() != textureSize))
+        {
+            textureGL = std::make_shared<BackendTextureOpenGL3>();
+            textureGL->loadTextureOnly(textureSize, nullptr, false);
+            texture = textureGL;
+        }
+
+        RenderLayer layer;
+        layer.texture = textureGL;
+        layer.viewRect = m_viewRect;
+        layer.viewport = m_viewport;
+        layer.targetSize = m_targetSize;
+        layer.clipLayers = std::move(m_clipLayers);
+        layer.pixelsPerPoint = m_pixelsPerPoint;
+        layer.projectionTransform = m_projectionTransform;
+        layer.scissorRect = m_scissorRect;
+        TGUI_GL_CHECK(glGetIntegerv(GL_VIEWPORT, layer.viewportGL.data()));
+        TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &layer.drawFrameBuffer));
+        TGUI_GL_CHECK(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &layer.readFrameBuffer));
+        m_renderLayers.push_back(std::move(layer));
+        m_clipLayers.clear();
+
+        // A single framebuffer is used for all textures, nested layers just attach a different texture to it
+        if (!m_renderLayerFrameBuffer)
+            TGUI_GL_CHECK(glGenFramebuffers(1, &m_renderLayerFrameBuffer));
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_renderLayerFrameBuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureGL->getInternalTexture(), 0));
+
+        // The texture becomes the new target, with the top left corner of the area at (0,0)
+        m_viewRect = {{0, 0}, size};
+        m_viewport = {0, 0, static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+        m_targetSize = {m_viewport.width, m_viewport.height};
+        m_pixelsPerPoint = {m_viewport.width / size.x, m_viewport.height / size.y};
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1, 1});
+        m_projectionTransform.scale({2.f / size.x, -2.f / size.y});
+
+        m_scissorRect = {{0, 0, static_cast<int>(textureSize.x), static_cast<int>(textureSize.y)}};
+        TGUI_GL_CHECK(glViewport(0, 0, static_cast<GLsizei>(textureSize.x), static_cast<GLsizei>(textureSize.y)));
+        TGUI_GL_CHECK(glScissor(0, 0, static_cast<GLsizei>(textureSize.x), static_cast<GLsizei>(textureSize.y)));
+
+        // Start with a fully transparent texture
+        GLfloat oldClearColor[4];
+        TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, static_cast<GLfloat*>(oldClearColor)));
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+
+        applyBlendFunc();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::endRenderToTexture()
+    {
+        TGUI_ASSERT(!m_renderLayers.empty(), "endRenderToTexture can only be called after beginRenderToTexture");
+
+        flushDeferredDrawCalls();
+        flushBatch();
+
+        RenderLayer& layer = m_renderLayers.back();
+        m_viewRect = layer.viewRect;
+        m_viewport = layer.viewport;
+        m_targetSize = layer.targetSize;
+        m_clipLayers = std::move(layer.clipLayers);
+        m_pixelsPerPoint = layer.pixelsPerPoint;
+        m_projectionTransform = layer.projectionTransform;
+        m_scissorRect = layer.scissorRect;
+        TGUI_GL_CHECK(glViewport(layer.viewportGL[0], layer.viewportGL[1], static_cast<GLsizei>(layer.viewportGL[2]), static_cast<GLsizei>(layer.viewportGL[3])));
+        TGUI_GL_CHECK(glScissor(m_scissorRect[0], m_scissorRect[1], m_scissorRect[2], m_scissorRect[3]));
+
+        const auto oldDrawFrameBuffer = static_cast<GLuint>(layer.drawFrameBuffer);
+        const auto oldReadFrameBuffer = static_cast<GLuint>(layer.readFrameBuffer);
+        m_renderLayers.pop_back();
+
+        if (!m_renderLayers.empty())
+        {
+            // Continue rendering to the texture of the parent layer
+            TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                                                 m_renderLayers.back().texture->getInternalTexture(), 0));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, oldDrawFrameBuffer));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, oldReadFrameBuffer));
+        }
+
+        applyBlendFunc();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawRenderedTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture, Vector2f size)
+    {
+        // The colors in the texture were already multiplied with their alpha value, so a different blend function is needed.
+        // The draw call can't be reordered or batched with others because of this.
+        flushDeferredDrawCalls();
+        flushBatch();
+        TGUI_GL_CHECK(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        RenderStates transformedStates = states;
+        transformedStates.transform.roundPosition(m_pixelsPerPoint);
+
+        // OpenGL stores the bottom row of the texture first, so the texture coordinates are flipped vertically
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 1}},
+            {{size.x, 0}, vertexColor, {1, 1}},
+            {{0, size.y}, vertexColor, {0, 0}},
+            {{size.x, size.y}, vertexColor, {1, 0}},
+        }};
+        const std::array<unsigned int, 6> indices = {{
+            0, 2, 1,
+            1, 2, 3
+        }};
+
+        const bool drawCallReorderingEnabled = m_drawCallReorderingEnabled;
+        m_drawCallReorderingEnabled = false;
+        drawVertexArray(transformedStates, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+        flushBatch();
+        m_drawCallReorderingEnabled = drawCallReorderingEnabled;
+
+        applyBlendFunc();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setBatchingEnabled(bool enabled)
+    {
+        flushBatch();
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setQuadInstancingEnabled(bool enabled)
+    {
+        flushBatch();
+        m_quadInstancingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isQuadInstancingEnabled() const
+    {
+        return m_quadInstancingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetOpenGL3::getUploadedByteCount() const
+    {
+        return m_uploadedByteCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        std::array<int, 4> scissorRect = {{0, 0, 0, 0}};
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
 
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            scissorRect = {{static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
+                            static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)}};
         }
         else // Clip the entire window
-        {
             m_pixelsPerPoint = {1, 1};
 
-            TGUI_GL_CHECK(glScissor(0, 0, 0, 0));
+        // Nested clipping layers often result in the same scissor rectangle, there is no need to break the batch in that case
+        if (scissorRect == m_scissorRect)
+            return;
+
+        flushBatch();
+
+        m_scissorRect = scissorRect;
+        TGUI_GL_CHECK(glScissor(scissorRect[0], scissorRect[1], scissorRect[2], scissorRect[3]));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::flushBatch()
+    {
+        if (!m_quadInstances.empty())
+            flushQuadInstances();
+
+        if (m_batchIndices.empty())
+        {
+            m_batchVertices.clear();
+            return;
         }
+
+        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        const std::size_t vertexOffset = uploadToStreamBuffer(*m_vertexStreamBuffer, GL_ARRAY_BUFFER,
+            m_batchVertices.data(), m_batchVertices.size() * sizeof(Vertex), sizeof(Vertex));
+        const std::size_t indexOffset = uploadToStreamBuffer(*m_indexStreamBuffer, GL_ELEMENT_ARRAY_BUFFER,
+            m_batchIndices.data(), m_batchIndices.size() * sizeof(GLuint), sizeof(GLuint));
+
+        TGUI_GL_CHECK(glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_INT,
+                                               reinterpret_cast<GLvoid*>(indexOffset), static_cast<GLint>(vertexOffset / sizeof(Vertex))));
+
+        // Clearing the vectors keeps their capacity, so no memory has to be allocated during the next frame
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::bindTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (m_currentTexture == texture)
+            return;
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+            m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+        }
+        else
+        {
+            m_currentTexture = nullptr;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        }
+
+        // The shader has to know whether the texture contains a distance field, the uniform is only updated when this changes
+        const bool distanceField = texture && texture->isDistanceField();
+        if (m_distanceFieldTextureBound != distanceField)
+        {
+            TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, distanceField ? 1 : 0));
+            m_distanceFieldTextureBound = distanceField;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::prepareBackBuffer()
+    {
+        const Vector2u size{static_cast<unsigned int>(m_targetSize.x), static_cast<unsigned int>(m_targetSize.y)};
+        if (m_backBufferFrameBuffer && m_backBufferTexture && (m_backBufferTexture->getSize() == size))
+            return true;
+
+        if (!m_backBufferTexture)
+            m_backBufferTexture = std::make_unique<BackendTextureOpenGL3>();
+        m_backBufferTexture->loadTextureOnly(size, nullptr, false);
+
+        if (!m_backBufferFrameBuffer)
+            TGUI_GL_CHECK(glGenFramebuffers(1, &m_backBufferFrameBuffer));
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFrameBuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_backBufferTexture->getInternalTexture(), 0));
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::canDrawQuadInstances() const
+    {
+        // Reordered draw calls are recorded as vertices, so quads have to be drawn as vertices too to keep the correct order
+        return m_quadInstancingEnabled && m_batchingEnabled && !m_drawCallReorderingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::addQuadInstance(const Transform& transform, FloatRect rect, FloatRect texRect, Vertex::Color color,
+                                                     const Borders& borders, Vertex::Color borderColor, float radius,
+                                                     const std::shared_ptr<BackendTexture>& texture)
+    {
+        // Instances can only be added to the current batch if they use the same texture and no vertices are pending
+        if (m_currentTexture != texture)
+        {
+            flushBatch();
+            bindTexture(texture);
+        }
+        else if (!m_batchIndices.empty())
+            flushBatch();
+
+        constexpr std::size_t maxBatchInstanceCount = 16384;
+        if (m_quadInstances.size() >= maxBatchInstanceCount)
+            flushBatch();
+
+        const auto& matrix = transform.getMatrix();
+
+        QuadInstance instance;
+        instance.rect = {{rect.left, rect.top, rect.width, rect.height}};
+        instance.texRect = {{texRect.left, texRect.top, texRect.left + texRect.width, texRect.top + texRect.height}};
+        instance.transformX = {{matrix[0], matrix[4], matrix[12]}};
+        instance.transformY = {{matrix[1], matrix[5], matrix[13]}};
+        instance.borders = {{borders.getLeft(), borders.getTop(), borders.getRight(), borders.getBottom()}};
+        instance.radius = radius;
+        instance.color = color;
+        instance.borderColor = borderColor;
+        m_quadInstances.push_back(instance);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::flushQuadInstances()
+    {
+        TGUI_GL_CHECK(glUseProgram(m_quadShaderProgram));
+        TGUI_GL_CHECK(glBindVertexArray(m_quadVertexArray));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_quadInstanceBuffer));
+        glUniformMatrix4fv(m_quadProjectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        // Drawing instances with an offset requires OpenGL 4.2, so the attributes are changed to point to the uploaded data instead
+        const std::size_t instanceOffset = uploadToStreamBuffer(*m_quadInstanceStreamBuffer, GL_ARRAY_BUFFER,
+            m_quadInstances.data(), m_quadInstances.size() * sizeof(QuadInstance), sizeof(QuadInstance));
+        setQuadInstanceAttributes(instanceOffset);
+
+        TGUI_GL_CHECK(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(m_quadInstances.size())));
+        m_quadInstances.clear();
+
+        // Restore the state that is expected when drawing vertices
+        TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+        TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setQuadInstanceAttributes(std::size_t offset)
+    {
+        const auto setInstanceAttribute = [offset](GLuint index, GLint size, GLenum type, GLboolean normalized, std::size_t attributeOffset) {
+            TGUI_GL_CHECK(glVertexAttribPointer(index, size, type, normalized, sizeof(QuadInstance), reinterpret_cast<GLvoid*>(offset + attributeOffset)));
+        };
+        setInstanceAttribute(1, 4, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, rect));
+        setInstanceAttribute(2, 4, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, texRect));
+        setInstanceAttribute(3, 3, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, transformX));
+        setInstanceAttribute(4, 3, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, transformY));
+        setInstanceAttribute(5, 4, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, borders));
+        setInstanceAttribute(6, 1, GL_FLOAT, GL_FALSE, offsetof(QuadInstance, radius));
+        setInstanceAttribute(7, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(QuadInstance, color));
+        setInstanceAttribute(8, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(QuadInstance, borderColor));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetOpenGL3::uploadToStreamBuffer(StreamBuffer& stream, unsigned int target, const void* data,
+                                                                std::size_t dataSize, std::size_t alignment)
+    {
+        m_uploadedByteCount += dataSize;
+        return stream.upload(target, data, dataSize, alignment, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::applyBlendFunc()
+    {
+        // When rendering to a texture, the alpha channel has to be stored correctly so that the texture can be blended later
+        if (m_renderLayers.empty())
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+        else
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,6 +1011,37 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::createQuadBuffers()
+    {
+        TGUI_GL_CHECK(glGenVertexArrays(1, &m_quadVertexArray));
+        TGUI_GL_CHECK(glBindVertexArray(m_quadVertexArray));
+
+        // The unit quad is drawn as a triangle strip and never changes
+        const std::array<float, 8> corners = {{0, 0, 1, 0, 0, 1, 1, 1}};
+        TGUI_GL_CHECK(glGenBuffers(1, &m_quadVertexBuffer));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_quadVertexBuffer));
+        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(corners)), corners.data(), GL_STATIC_DRAW));
+
+        TGUI_GL_CHECK(glEnableVertexAttribArray(0));
+        TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), reinterpret_cast<GLvoid*>(0)));
+
+        // All other attributes are stored per instance
+        TGUI_GL_CHECK(glGenBuffers(1, &m_quadInstanceBuffer));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_quadInstanceBuffer));
+
+        for (GLuint index = 1; index <= 8; ++index)
+        {
+            TGUI_GL_CHECK(glEnableVertexAttribArray(index));
+            TGUI_GL_CHECK(glVertexAttribDivisor(index, 1));
+        }
+        setQuadInstanceAttributes(0);
+
+        TGUI_GL_CHECK(glBindVertexArray(0));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,6 +99,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureOpenGL3::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_textureId)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureOpenGL3::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -79,6 +79,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureRaylib::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture.id)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+
+        const Rectangle rect{static_cast<float>(region.left), static_cast<float>(region.top),
+                             static_cast<float>(region.width), static_cast<float>(region.height)};
+        UpdateTextureRec(m_texture, rect, pixels);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureRaylib::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
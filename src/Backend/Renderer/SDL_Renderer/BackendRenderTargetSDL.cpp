@@ -111,6 +111,7 @@ namespace tgui
 
         // Draw the widgets
         root->draw(*this, {});
+        flushBatch();
 
         // Restore the old blend mode
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
@@ -143,6 +144,38 @@ namespace tgui
         }
 
         const Transform finalTransform = m_projectionTransform * states.transform;
+        if (m_batchingEnabled)
+        {
+            // Draw the vertices that were collected so far if they use a different texture
+            if ((m_batchTexture != texture) && !m_batchIndices.empty())
+                flushBatch();
+
+            m_batchTexture = texture;
+
+            const int indexOffset = static_cast<int>(m_batchVertices.size());
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                const Vertex& vertex = vertices[i];
+                m_batchVertices.push_back({finalTransform.transformPoint(vertex.position), vertex.color, vertex.texCoords});
+#if SDL_MAJOR_VERSION >= 3
+                m_batchColors.push_back({{vertex.color.red / 255.f, vertex.color.green / 255.f, vertex.color.blue / 255.f, vertex.color.alpha / 255.f}});
+#endif
+            }
+
+            if (indices)
+            {
+                for (std::size_t i = 0; i < indexCount; ++i)
+                    m_batchIndices.push_back(indexOffset + static_cast<int>(indices[i]));
+            }
+            else // No indices were given, all vertices need to be drawn in the order they were provided
+            {
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                    m_batchIndices.push_back(indexOffset + static_cast<int>(i));
+            }
+
+            return;
+        }
+
 #if SDL_MAJOR_VERSION >= 3
         std::vector<SDL_Vertex> verticesSDL;
         verticesSDL.reserve(vertexCount);
@@ -181,8 +214,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSDL::setBatchingEnabled(bool enabled)
+    {
+        flushBatch();
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSDL::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSDL::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        // The vertices that were already collected still need to be drawn with the old clipping
+        flushBatch();
+
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
@@ -203,6 +254,45 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::flushBatch()
+    {
+        if (m_batchIndices.empty())
+        {
+            m_batchVertices.clear();
+            m_batchColors.clear();
+            return;
+        }
+
+        SDL_Texture* textureSDL = nullptr;
+        if (m_batchTexture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(m_batchTexture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
+            textureSDL = std::static_pointer_cast<BackendTextureSDL>(m_batchTexture)->getInternalTexture();
+        }
+
+#if SDL_MAJOR_VERSION >= 3
+        static_assert(sizeof(std::array<float, 4>) == sizeof(SDL_FColor), "SDL_FColor requires same memory layout as std::array<float, 4> for cast to work");
+        SDL_RenderGeometryRaw(m_renderer, textureSDL,
+                              &m_batchVertices.data()->position.x, sizeof(Vertex),
+                              reinterpret_cast<const SDL_FColor*>(m_batchColors.data()), sizeof(SDL_FColor),
+                              &m_batchVertices.data()->texCoords.x, sizeof(Vertex),
+                              static_cast<int>(m_batchVertices.size()), m_batchIndices.data(), static_cast<int>(m_batchIndices.size()), sizeof(int));
+#else
+        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
+        SDL_RenderGeometry(m_renderer, textureSDL,
+                           reinterpret_cast<const SDL_Vertex*>(m_batchVertices.data()), static_cast<int>(m_batchVertices.size()),
+                           m_batchIndices.data(), static_cast<int>(m_batchIndices.size()));
+#endif
+
+        // The vectors keep their capacity, so that no memory has to be allocated while collecting the next batch
+        m_batchVertices.clear();
+        m_batchColors.clear();
+        m_batchIndices.clear();
+        m_batchTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +138,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+
+        SDL_Rect rect;
+        rect.x = static_cast<int>(region.left);
+        rect.y = static_cast<int>(region.top);
+        rect.w = static_cast<int>(region.width);
+        rect.h = static_cast<int>(region.height);
+        SDL_UpdateTexture(m_texture, &rect, pixels, static_cast<int>(region.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -66,6 +66,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture->update(pixels, {region.width, region.height}, {region.left, region.top});
+#else
+        m_texture->update(pixels, region.width, region.height, region.left, region.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
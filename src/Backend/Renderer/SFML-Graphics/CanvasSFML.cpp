@@ -275,6 +275,7 @@ namespace tgui
     void CanvasSFML::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,12 +187,14 @@ namespace tgui
             }
             case Event::Type::LostFocus:
             {
+                invalidate();
                 m_windowFocused = false;
                 onWindowUnfocus.emit(m_container.get());
                 break;
             }
             case Event::Type::GainedFocus:
             {
+                invalidate();
                 m_windowFocused = true;
                 onWindowFocus.emit(m_container.get());
                 break;
@@ -241,7 +243,89 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
-        m_backendRenderTarget->drawGui(m_container);
+        if (m_damageTrackingEnabled)
+        {
+            // The damaged region may be empty, in which case the render target only needs to show the previous frame again
+            m_backendRenderTarget->drawGuiRegion(m_container, m_fullRedrawRequired ? m_view.getRect() : m_damagedRegion);
+            m_fullRedrawRequired = false;
+            m_damagedRegion = {};
+        }
+        else
+            m_backendRenderTarget->drawGui(m_container);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setDamageTrackingEnabled(bool enabled)
+    {
+        m_damageTrackingEnabled = enabled;
+        m_fullRedrawRequired = true;
+        m_damagedRegion = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isDamageTrackingEnabled() const
+    {
+        return m_damageTrackingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidate()
+    {
+        m_fullRedrawRequired = true;
+        ++m_invalidationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidateRect(FloatRect rect)
+    {
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            return;
+
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // All damaged areas are combined into a single rectangle, which is what the render target will redraw
+        if ((m_damagedRegion.width <= 0) || (m_damagedRegion.height <= 0))
+            m_damagedRegion = rect;
+        else
+        {
+            const float left = std::min(m_damagedRegion.left, rect.left);
+            const float top = std::min(m_damagedRegion.top, rect.top);
+            const float right = std::max(m_damagedRegion.left + m_damagedRegion.width, rect.left + rect.width);
+            const float bottom = std::max(m_damagedRegion.top + m_damagedRegion.height, rect.top + rect.height);
+            m_damagedRegion = {left, top, right - left, bottom - top};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isRedrawRequired() const
+    {
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            return true;
+
+        return (m_damagedRegion.width > 0) && (m_damagedRegion.height > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendGui::getDamagedRegion() const
+    {
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            return m_view.getRect();
+
+        return m_damagedRegion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getInvalidationCount() const
+    {
+        return m_invalidationCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -580,6 +664,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> BackendGui::getTimeUntilNextUpdate() const
+    {
+        Optional<Duration> duration = Timer::getNextScheduledTime();
+
+        // Widgets aren't updated while the window doesn't have focus
+        if (m_windowFocused)
+        {
+            const Optional<Duration> widgetDuration = m_container->getTimeUntilNextUpdate();
+            if (widgetDuration && (!duration || (*widgetDuration < *duration)))
+                duration = widgetDuration;
+
+            if (m_tooltipPossible)
+            {
+                const Duration tooltipDelay = ToolTip::getInitialDelay();
+                const Duration timeLeft = (m_tooltipTime < tooltipDelay) ? tooltipDelay - m_tooltipTime : Duration{};
+                if (!duration || (timeLeft < *duration))
+                    duration = timeLeft;
+            }
+        }
+
+        // The durations are relative to the last time that updateTime was called
+        if (duration && (m_lastUpdateTime > std::chrono::steady_clock::time_point()))
+        {
+            const Duration timeSinceUpdate = std::chrono::steady_clock::now() - m_lastUpdateTime;
+            duration = (*duration > timeSinceUpdate) ? *duration - timeSinceUpdate : Duration{};
+        }
+
+        return duration;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendGui::mapPixelToCoords(Vector2i pixel) const
     {
         return {((pixel.x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -631,6 +747,8 @@ namespace tgui
 
     void BackendGui::updateContainerSize()
     {
+        invalidate();
+
         m_viewport.updateParentSize({static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
         m_view.updateParentSize({m_viewport.getWidth(), m_viewport.getHeight()});
 
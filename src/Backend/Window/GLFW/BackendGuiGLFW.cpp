@@ -423,6 +423,9 @@ namespace tgui
         glfwSetCursorEnterCallback(m_window, [](GLFWwindow* window, int entered) {
             static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->cursorEnterCallback(entered);
         });
+        glfwSetWindowRefreshCallback(m_window, [](GLFWwindow* window) {
+            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->invalidate();
+        });
 
         setDrawingUpdatesTime(false);
 
@@ -432,20 +435,36 @@ namespace tgui
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            bool renderPostponed = false;
+            // When damage tracking is enabled, we don't need to render anything if none of the widgets changed
+            if (isRedrawRequired())
             {
-                m_backendRenderTarget->clearScreen();
-                draw();
-                glfwSwapBuffers(m_window);
-                lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+                if (timePointNextAllowed <= timePointNow)
+                {
+                    m_backendRenderTarget->clearScreen();
+                    draw();
+                    glfwSwapBuffers(m_window);
+                    lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+                }
+                else
+                    renderPostponed = true;
             }
 
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
+            // Sleep until the next event arrives or until the gui has to be updated again. If we still have to render then
+            // we only wait until rendering is allowed again, timers and animations will be updated right before drawing.
+            Optional<Duration> timeout;
+            if (renderPostponed)
+                timeout = Duration{timePointNextAllowed - timePointNow};
+            else
+                timeout = getTimeUntilNextUpdate();
+
+            if (!timeout)
+                glfwWaitEvents();
+            else if (*timeout > Duration{})
+                glfwWaitEventsTimeout(static_cast<double>(timeout->asSeconds()));
+            else
+                glfwPollEvents();
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
             updateTime();
         }
     }
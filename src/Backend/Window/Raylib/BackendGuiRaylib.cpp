@@ -26,6 +26,8 @@
 #include <TGUI/Backend/Window/Raylib/BackendRaylib.hpp>
 
 #if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/Timer.hpp>
+
     #ifdef TGUI_SYSTEM_WINDOWS
         // raylib.h and windows.h give conflicts
         #define NOGDI
@@ -35,6 +37,10 @@
     #endif
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <thread>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -229,7 +235,7 @@ namespace tgui
 
         // In raylib the EndDrawing function handles event polling and it has no equivalent to a glfwWaitEventsTimeout function.
         // This means that we have no way of waiting for events while still running our timers (EnableEventWaiting will wait for
-        // an event but won't wake up when one of our timers expires).
+        // an event but won't wake up when one of our timers expires, so we only use it when nothing is scheduled).
         // So we have to rely on SetTargetFPS to reduce drawing. This isn't ideal, because no events are processed during sleeping
         // (causing delays in input/timer processing when the FPS is set too low), and no sleeping is performed at all on
         // low end systems that can't reach the target FPS. We let the user call the function themselves before calling mainLoop
@@ -253,6 +259,32 @@ namespace tgui
                 pressedKey = GetKeyPressed();
             }
 
+            // When damage tracking is enabled and none of the widgets changed, we don't render anything. EndDrawing would
+            // swap the buffers, so we have to poll the events ourselves and keep the timers running until something changes.
+            if (!isRedrawRequired())
+            {
+                PollInputEvents();
+                if (!updateTime())
+                {
+                    const Optional<Duration> duration = getTimeUntilNextUpdate();
+#ifdef RAYLIB_VERSION_MAJOR // EnableEventWaiting exists since raylib 4.2, but the version macros were only added in 4.5
+                    if (!duration)
+                    {
+                        // Nothing will change until the next event arrives, so we can let raylib block until then
+                        EnableEventWaiting();
+                        PollInputEvents();
+                        DisableEventWaiting();
+                        continue;
+                    }
+#endif
+                    if (duration && (*duration < std::chrono::milliseconds(10)))
+                        std::this_thread::sleep_for(std::chrono::nanoseconds(*duration));
+                    else
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+                continue;
+            }
+
             BeginDrawing();
             m_backendRenderTarget->clearScreen();
             draw();
@@ -32,6 +32,8 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <limits>
     #include <thread>
     #include <cmath>
 #endif
@@ -539,39 +541,42 @@ namespace tgui
 
         bool quit = false;
         bool refreshRequired = true;
+        bool eventProcessed = false;
+        const auto processEvent = [this,&quit,&eventProcessed](const SDL_Event& event){
+            if (handleEvent(event))
+                eventProcessed = true;
+
+            if (event.type == SDL_EVENT_QUIT)
+            {
+                quit = true;
+                eventProcessed = true;
+            }
+#if SDL_MAJOR_VERSION >= 3
+            else if ((event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) || (event.type == SDL_EVENT_WINDOW_EXPOSED)
+                  || (event.type == SDL_EVENT_WINDOW_MOUSE_ENTER) || (event.type == SDL_EVENT_WINDOW_MOUSE_LEAVE)
+                  || (event.type == SDL_EVENT_WINDOW_FOCUS_GAINED) || (event.type == SDL_EVENT_WINDOW_FOCUS_LOST))
+#else
+            else if ((event.type == SDL_WINDOWEVENT)
+                  && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)
+                   || (event.window.event == SDL_WINDOWEVENT_ENTER) || (event.window.event == SDL_WINDOWEVENT_LEAVE)
+                   || (event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED) || (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST)))
+#endif
+            {
+                // The window contents may have been lost, so everything needs to be redrawn
+                invalidate();
+                eventProcessed = true;
+            }
+        };
+
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!quit)
         {
-            bool eventProcessed = false;
+            eventProcessed = false;
             while (true)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
                 SDL_Event event;
                 while (SDL_PollEvent(&event) != 0)
-                {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_EVENT_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
-#if SDL_MAJOR_VERSION >= 3
-                    else if ((event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) || (event.type == SDL_EVENT_WINDOW_EXPOSED)
-                          || (event.type == SDL_EVENT_WINDOW_MOUSE_ENTER) || (event.type == SDL_EVENT_WINDOW_MOUSE_LEAVE)
-                          || (event.type == SDL_EVENT_WINDOW_FOCUS_GAINED) || (event.type == SDL_EVENT_WINDOW_FOCUS_LOST))
-#else
-                    else if ((event.type == SDL_WINDOWEVENT)
-                          && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)
-                           || (event.window.event == SDL_WINDOWEVENT_ENTER) || (event.window.event == SDL_WINDOWEVENT_LEAVE)
-                           || (event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED) || (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST)))
-#endif
-                    {
-                        eventProcessed = true;
-                    }
-                }
+                    processEvent(event);
 
                 if (updateTime())
                     break;
@@ -579,7 +584,29 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // Nothing changed, so sleep until the next event arrives or until the gui has to be updated again.
+                // The timeout is recalculated on every call, so events that keep coming won't postpone the deadline.
+                const Optional<Duration> timeout = getTimeUntilNextUpdate();
+                if (!timeout)
+                {
+                    if (SDL_WaitEvent(&event) != 0)
+                        processEvent(event);
+                }
+                else
+                {
+                    // Round up to whole milliseconds, waking up just before the deadline would only cause an extra iteration
+                    const auto timeoutNs = std::chrono::nanoseconds(*timeout).count();
+                    const auto timeoutMs = static_cast<int>(std::min<std::chrono::nanoseconds::rep>((timeoutNs + 999999) / 1000000, std::numeric_limits<int>::max()));
+                    if (SDL_WaitEventTimeout(&event, timeoutMs) != 0)
+                        processEvent(event);
+                }
+            }
+
+            // When damage tracking is enabled, we don't need to render anything if none of the widgets changed
+            if (!isRedrawRequired())
+            {
+                refreshRequired = false;
+                continue;
             }
 
             refreshRequired = true;
@@ -35,6 +35,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <thread>
 #endif
 
@@ -269,56 +270,53 @@ namespace tgui
         setDrawingUpdatesTime(false);
 
         bool refreshRequired = true;
-        std::chrono::steady_clock::time_point lastRenderTime;
+        bool eventProcessed = false;
         bool windowOpen = m_window->isOpen();
+        const auto processEvent = [this,&windowOpen,&eventProcessed](const sf::Event& event){
+            if (handleEvent(event))
+                eventProcessed = true;
+
+#if SFML_VERSION_MAJOR >= 3
+            if (event.is<sf::Event::Closed>())
+#else
+            if (event.type == sf::Event::Closed)
+#endif
+            {
+                // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
+                // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
+                // The close function will be called by the window destructor.
+                windowOpen = false;
+                eventProcessed = true;
+            }
+#if SFML_VERSION_MAJOR >= 3
+            else if (event.is<sf::Event::Resized>()
+                  || event.is<sf::Event::MouseEntered>() || event.is<sf::Event::MouseLeft>()
+                  || event.is<sf::Event::FocusGained>() || event.is<sf::Event::FocusLost>())
+#else
+            else if ((event.type == sf::Event::Resized)
+                  || (event.type == sf::Event::MouseEntered) || (event.type == sf::Event::MouseLeft)
+                  || (event.type == sf::Event::GainedFocus) || (event.type == sf::Event::LostFocus))
+#endif
+            {
+                // The window contents may have been lost, so everything needs to be redrawn
+                invalidate();
+                eventProcessed = true;
+            }
+        };
+
+        std::chrono::steady_clock::time_point lastRenderTime;
         while (m_window->isOpen()) // Don't just check windowOpen, user code can also call window.close()
         {
-            bool eventProcessed = false;
+            eventProcessed = false;
             while (true)
             {
 #if SFML_VERSION_MAJOR >= 3
                 while (const auto event = m_window->pollEvent())
-                {
-                    if (handleEvent(*event))
-                        eventProcessed = true;
-
-                    if (event->is<sf::Event::Closed>())
-                    {
-                        // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
-                        // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
-                        // The close function will be called by the window destructor.
-                        windowOpen = false;
-                        eventProcessed = true;
-                    }
-                    else if (event->is<sf::Event::Resized>()
-                          || event->is<sf::Event::MouseEntered>() || event->is<sf::Event::MouseLeft>()
-                          || event->is<sf::Event::FocusGained>() || event->is<sf::Event::FocusLost>())
-                    {
-                        eventProcessed = true;
-                    }
-                }
+                    processEvent(*event);
 #else
                 sf::Event event;
                 while (m_window->pollEvent(event))
-                {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == sf::Event::Closed)
-                    {
-                        // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
-                        // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
-                        // The close function will be called by the window destructor.
-                        windowOpen = false;
-                        eventProcessed = true;
-                    }
-                    else if ((event.type == sf::Event::Resized)
-                          || (event.type == sf::Event::MouseEntered) || (event.type == sf::Event::MouseLeft)
-                          || (event.type == sf::Event::GainedFocus) || (event.type == sf::Event::LostFocus))
-                    {
-                        eventProcessed = true;
-                    }
-                }
+                    processEvent(event);
 #endif
                 if (updateTime())
                     break;
@@ -326,12 +324,40 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // Nothing changed, so sleep until the next event arrives or until the gui has to be updated again
+                const Optional<Duration> timeout = getTimeUntilNextUpdate();
+#if SFML_VERSION_MAJOR >= 3
+                if (!timeout)
+                {
+                    if (const auto waitedEvent = m_window->waitEvent())
+                        processEvent(*waitedEvent);
+                }
+                else if (*timeout >= std::chrono::microseconds(1)) // A timeout of sf::Time::Zero would wait forever
+                {
+                    if (const auto waitedEvent = m_window->waitEvent(*timeout))
+                        processEvent(*waitedEvent);
+                }
+#else
+                if (!timeout)
+                {
+                    if (m_window->waitEvent(event))
+                        processEvent(event);
+                }
+                else // SFML 2 can't wait for events with a timeout, so we still have to poll until the deadline
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(*timeout, Duration{std::chrono::milliseconds(10)})));
+#endif
             }
 
             if (!windowOpen)
                 break;
 
+            // When damage tracking is enabled, we don't need to render anything if none of the widgets changed
+            if (!isRedrawRequired())
+            {
+                refreshRequired = false;
+                continue;
+            }
+
             refreshRequired = true;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
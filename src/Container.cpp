@@ -31,7 +31,10 @@
 #include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
     #include <fstream>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,7 +172,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget               {other},
+        m_renderCacheEnabled {other.m_renderCacheEnabled},
+        m_spatialIndexEnabled{other.m_spatialIndexEnabled}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -193,8 +198,14 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_renderCacheEnabled      {std::move(other.m_renderCacheEnabled)},
+        m_renderCacheTexture      {std::move(other.m_renderCacheTexture)},
+        m_spatialIndexEnabled     {std::move(other.m_spatialIndexEnabled)}
     {
+        // The widgets will request time updates again when their parent is set
+        other.m_timeDependentWidgets.clear();
+
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
         // give a warning if it still has its old parent where it won't find any siblings.
@@ -230,6 +241,12 @@ namespace tgui
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
             m_draggingWidget = false;
+            m_renderCacheEnabled = right.m_renderCacheEnabled;
+            m_renderCacheValid = false;
+            m_renderCacheTexture = nullptr;
+            m_spatialIndexEnabled = right.m_spatialIndexEnabled;
+            m_spatialIndex = {};
+            m_childDrawBounds = {};
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -263,6 +280,14 @@ namespace tgui
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
             m_draggingWidget           = std::move(right.m_draggingWidget);
+            m_renderCacheEnabled       = std::move(right.m_renderCacheEnabled);
+            m_renderCacheValid         = false;
+            m_renderCacheTexture       = std::move(right.m_renderCacheTexture);
+            m_spatialIndexEnabled      = std::move(right.m_spatialIndexEnabled);
+            m_spatialIndex             = {};
+            m_childDrawBounds          = {};
+            m_timeDependentWidgets.clear();
+            right.m_timeDependentWidgets.clear();
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -307,10 +332,13 @@ namespace tgui
         TGUI_ASSERT(widgetPtr != nullptr, "Can't add nullptr to container");
 
         m_widgets.push_back(widgetPtr);
+        m_spatialIndex.valid = false;
+        m_childDrawBounds.valid = false;
         if (!widgetName.empty())
             widgetPtr->setWidgetName(widgetName);
 
         widgetAdded(widgetPtr);
+        widgetPtr->invalidate();
 
         if (widgetPtr->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
@@ -363,6 +391,8 @@ namespace tgui
             if (m_widgets[i] != widget)
                 continue;
 
+            widget->invalidate();
+
             if (widget == m_widgetBelowMouse && m_parentGui && (widget->getMouseCursor() != m_mouseCursor))
                 m_parentGui->requestMouseCursor(m_mouseCursor);
 
@@ -394,6 +424,12 @@ namespace tgui
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            m_spatialIndex.valid = false;
+            m_childDrawBounds.valid = false;
+
+            const auto timeDependentIt = std::find(m_timeDependentWidgets.begin(), m_timeDependentWidgets.end(), widget);
+            if (timeDependentIt != m_timeDependentWidgets.end())
+                m_timeDependentWidgets.erase(timeDependentIt);
 
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
@@ -418,9 +454,15 @@ namespace tgui
             m_focusedWidget->setFocused(false);
 
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidate();
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
+        m_spatialIndex.valid = false;
+        m_childDrawBounds.valid = false;
+        m_timeDependentWidgets.clear();
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -712,6 +754,9 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widgetToMove);
+        m_spatialIndex.valid = false;
+        m_childDrawBounds.valid = false;
+        widgetToMove->invalidate();
 
         if (widgetToMove->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
@@ -772,31 +817,53 @@ namespace tgui
 
         pos -= widgetsOffset;
 
-        for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
+        // Look for a visible widget below the mouse
+        Widget::Ptr widget = getWidgetBelowMouse(pos);
+        if (!widget)
+            return nullptr;
+
+        // If the widget is a container then look inside it if we are looking for the leaf widget
+        if (recursive && widget->isContainer())
         {
-            const auto& widget = *it;
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            auto childWidget = container->getWidgetAtPos(transformMousePos(widget, pos) - container->getPosition(), true);
+            if (childWidget)
+                return childWidget;
+        }
 
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible() || widget->getIgnoreMouseEvents())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget
+        return widget;
+    }
 
-            // If the widget is a container then look inside it if we are looking for the leaf widget
-            if (recursive && widget->isContainer())
-            {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPos(transformMousePos(widget, pos) - container->getPosition(), true);
-                if (childWidget)
-                    return childWidget;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
-        }
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_renderCacheEnabled = enabled;
+        m_renderCacheValid = false;
+        m_renderCacheTexture = nullptr;
+    }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        m_spatialIndexEnabled = enabled;
+        m_spatialIndex = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndexEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1136,12 +1203,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isEventHandledByWidgetItself(const Widget::Ptr& widget, bool mouseEvent)
+    {
+        if (!widget->isContainer())
+            return true;
+
+        const auto& container = static_cast<const Container&>(*widget);
+        if (mouseEvent)
+            return !container.m_widgetBelowMouse && !(container.m_widgetWithLeftMouseDown && container.m_draggingWidget);
+        else
+            return !container.m_focusedWidget || !container.m_focusedWidget->isFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::processMouseMoveEvent(Vector2f mousePos)
     {
         // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them
         if (m_widgetWithLeftMouseDown && m_draggingWidget)
         {
-            m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
+            const Widget::Ptr widget = m_widgetWithLeftMouseDown;
+            const bool handledByWidget = isEventHandledByWidgetItself(widget, true);
+            widget->mouseMoved(transformMousePos(widget, mousePos));
+            if (handledByWidget || isEventHandledByWidgetItself(widget, true))
+                widget->invalidate();
             return true;
         }
 
@@ -1151,8 +1236,15 @@ namespace tgui
         Widget::Ptr widget = updateWidgetBelowMouse(mousePos);
         if (widget != nullptr)
         {
-            // Send the event to the widget
+            // Send the event to the widget. The widget only needs to be redrawn if it handles the event itself and the part
+            // below the mouse changed (e.g. when the mouse moves onto a scrollbar arrow). Other changes, like a different item
+            // being hovered in a list box, are reported by the widget itself. If the event is passed on to a child widget then
+            // the child will be redrawn instead.
+            const bool handledByWidget = isEventHandledByWidgetItself(widget, true);
+            const std::size_t oldHoverStateId = widget->getHoverStateId();
             widget->mouseMoved(transformMousePos(widget, mousePos));
+            if ((handledByWidget || isEventHandledByWidgetItself(widget, true)) && (widget->getHoverStateId() != oldHoverStateId))
+                widget->invalidate();
             return true;
         }
 
@@ -1187,11 +1279,15 @@ namespace tgui
             if (!widget->isContainer())
                 widget->setFocused(true);
 
+            const bool handledByWidget = isEventHandledByWidgetItself(widget, true);
             if (button == Event::MouseButton::Left)
                 m_draggingWidget = widget->leftMousePressed(transformMousePos(widget, mousePos));
             else if (button == Event::MouseButton::Right)
                 widget->rightMousePressed(transformMousePos(widget, mousePos));
 
+            if (handledByWidget || isEventHandledByWidgetItself(widget, true))
+                widget->invalidate();
+
             return true;
         }
         else // The mouse did not went down on a widget, so unfocus the focused child widget, but keep ourselves focused
@@ -1220,10 +1316,18 @@ namespace tgui
     {
         Widget::Ptr widgetBelowMouse = updateWidgetBelowMouse(mousePos);
         if (widgetBelowMouse != nullptr)
+        {
+            const bool handledByWidget = isEventHandledByWidgetItself(widgetBelowMouse, true);
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
+            if (handledByWidget || isEventHandledByWidgetItself(widgetBelowMouse, true))
+                widgetBelowMouse->invalidate();
+        }
 
         if ((button == Event::MouseButton::Left) && m_widgetWithLeftMouseDown)
         {
+            if (isEventHandledByWidgetItself(m_widgetWithLeftMouseDown, true))
+                m_widgetWithLeftMouseDown->invalidate();
+
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             m_draggingWidget = false;
@@ -1247,7 +1351,13 @@ namespace tgui
         Widget::Ptr widget = updateWidgetBelowMouse(pos);
 
         if (widget != nullptr)
-            return widget->scrolled(delta, transformMousePos(widget, pos), touch);
+        {
+            // Scrolling can move all the contents of a container, so the widget is redrawn even if it is a container
+            const bool scrolled = widget->scrolled(delta, transformMousePos(widget, pos), touch);
+            if (scrolled)
+                widget->invalidate();
+            return scrolled;
+        }
 
         return false;
     }
@@ -1264,8 +1374,12 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             // Tell the widget that the key was pressed
+            const Widget::Ptr focusedWidget = m_focusedWidget;
+            const bool handledByWidget = isEventHandledByWidgetItself(focusedWidget, false);
             const bool bHandled = m_focusedWidget->canHandleKeyPress(event); // TGUI_NEXT: Have keyPressed return a bool
             m_focusedWidget->keyPressed(event); // Called even if bHandled is false for backwards compatibility
+            if (handledByWidget || isEventHandledByWidgetItself(focusedWidget, false))
+                focusedWidget->invalidate();
             if (!bHandled)
             {
                 if ((event.code == Event::KeyboardKey::Up) && m_focusedWidget->getNavigationUp())
@@ -1306,7 +1420,11 @@ namespace tgui
         // Tell the widget that the key was pressed
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
-            m_focusedWidget->textEntered(key);
+            const Widget::Ptr focusedWidget = m_focusedWidget;
+            const bool handledByWidget = isEventHandledByWidgetItself(focusedWidget, false);
+            focusedWidget->textEntered(key);
+            if (handledByWidget || isEventHandledByWidgetItself(focusedWidget, false))
+                focusedWidget->invalidate();
             return true;
         }
 
@@ -1318,20 +1436,69 @@ namespace tgui
     bool Container::updateTime(Duration elapsedTime)
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
-
-        // Loop through all widgets
-        for (auto& widget : m_widgets)
+        if (m_timeDependentWidgets.empty())
+            return screenRefreshRequired;
+
+        // Only the widgets that requested time updates need to be updated. We loop over a copy of the list, because callbacks
+        // (e.g. when an animation finishes) could add or remove widgets while we are updating them.
+        const std::vector<Widget::Ptr> timeDependentWidgets = m_timeDependentWidgets;
+        std::vector<const Widget*> changedWidgets;
+        for (const auto& widget : timeDependentWidgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (widget->isVisible())
-                screenRefreshRequired |= widget->updateTime(elapsedTime);
+            // Skip widgets that were removed from the container by a callback
+            if (widget->getParent() != this)
+                continue;
+
+            // Update the elapsed time in widgets that need it. We can't know which part of the widget changed, so even
+            // containers are redrawn entirely when one of their children changes.
+            if (widget->isVisible() && widget->updateTime(elapsedTime))
+            {
+                widget->invalidate();
+                changedWidgets.push_back(widget.get());
+                screenRefreshRequired = true;
+            }
         }
 
+        // Widgets that no longer depend on time don't have to be updated until they request it again.
+        // Hidden widgets with a pending animation remain in the list, but they aren't updated until they are shown.
+        // A widget that changed in updateTime is updated again, even when it didn't override getTimeUntilNextUpdate.
+        m_timeDependentWidgets.erase(std::remove_if(m_timeDependentWidgets.begin(), m_timeDependentWidgets.end(),
+            [this, &changedWidgets](const Widget::Ptr& widget){
+                return (widget->getParent() != this)
+                    || (!widget->getTimeUntilNextUpdate()
+                        && (std::find(changedWidgets.begin(), changedWidgets.end(), widget.get()) == changedWidgets.end()));
+            }),
+            m_timeDependentWidgets.end());
+
         return screenRefreshRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Container::getTimeUntilNextUpdate() const
+    {
+        Optional<Duration> duration = Widget::getTimeUntilNextUpdate();
+        for (const auto& widget : m_timeDependentWidgets)
+        {
+            // Only visible widgets are updated in updateTime
+            if (!widget->isVisible())
+                continue;
+
+            // A widget without a deadline is only in the list when it has to be updated on the next frame, e.g. because it
+            // was just added or because it changed during the last update.
+            const Optional<Duration> widgetDuration = widget->getTimeUntilNextUpdate();
+            if (!widgetDuration)
+                return Duration{};
+
+            if (!duration || (*widgetDuration < *duration))
+                duration = widgetDuration;
+        }
+
+        return duration;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setParent(Container* parent)
     {
         const BackendGui* oldParentGui = m_parentGui;
@@ -1457,6 +1624,30 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        if (m_spatialIndexEnabled && updateSpatialIndex())
+        {
+            // Only the widgets that overlap with the grid cell below the mouse have to be checked
+            if (!m_spatialIndex.area.contains(mousePos))
+                return nullptr;
+
+            const auto column = std::min(static_cast<std::size_t>((mousePos.x - m_spatialIndex.area.left) / m_spatialIndex.cellSize.x), m_spatialIndex.columns - 1);
+            const auto row = std::min(static_cast<std::size_t>((mousePos.y - m_spatialIndex.area.top) / m_spatialIndex.cellSize.y), m_spatialIndex.rows - 1);
+            const auto& cell = m_spatialIndex.cells[(row * m_spatialIndex.columns) + column];
+            for (auto it = cell.crbegin(); it != cell.crend(); ++it)
+            {
+                const auto& widget = m_widgets[*it];
+                if (!widget->isVisible() || widget->getIgnoreMouseEvents())
+                    continue;
+
+                if (!widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                    continue;
+
+                return widget;
+            }
+
+            return nullptr;
+        }
+
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
         {
             const auto& widget = *it;
@@ -1492,32 +1683,116 @@ namespace tgui
 
     void Container::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        for (const auto& widget : m_widgets)
+        drawChildWidgets(target, states, {{}, getInnerSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawChildWidgets(BackendRenderTarget& target, RenderStates states, FloatRect area) const
+    {
+        if (m_renderCacheEnabled && (area.width > 0) && (area.height > 0))
         {
-            if (!widget->isVisible())
-                continue;
+            const std::uint64_t guiInvalidationCount = m_parentGui ? m_parentGui->getInvalidationCount() : 0;
+            const Vector2f pixelsPerPoint = target.getPixelsPerPoint();
+            if (!m_renderCacheValid || (area != m_renderCacheArea) || (pixelsPerPoint != m_renderCachePixelsPerPoint)
+             || (guiInvalidationCount != m_renderCacheGuiInvalidationCount))
+            {
+                m_renderCacheValid = false;
+                if (target.beginRenderToTexture(m_renderCacheTexture, area.getSize()))
+                {
+                    RenderStates textureStates;
+                    textureStates.transform.translate(-area.getPosition());
+                    drawChildWidgets(target, textureStates, {}); // Empty area, so the widgets are drawn directly
+                    target.endRenderToTexture();
+
+                    m_renderCacheValid = true;
+                    m_renderCacheArea = area;
+                    m_renderCachePixelsPerPoint = pixelsPerPoint;
+                    m_renderCacheGuiInvalidationCount = guiInvalidationCount;
+                }
+            }
+
+            // The cached texture is drawn instead of the widgets, unless the render target doesn't support render to texture
+            if (m_renderCacheValid)
+            {
+                states.transform.translate(area.getPosition());
+                target.drawRenderedTexture(states, m_renderCacheTexture, area.getSize());
+                return;
+            }
+        }
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+        // When the bounds of the children are cached, widgets outside the clipping area are skipped without even calculating
+        // their transformation, so that an entire subtree is rejected with a single check. If the children are placed in order
+        // (e.g. in a Grid or in a vertical list inside a ScrollablePanel) then only the range that can be visible is checked.
+        std::size_t firstIndex = 0;
+        std::size_t endIndex = m_widgets.size();
+        bool cullWidgets = false;
+        FloatRect visibleRect;
+        const std::array<float, 16>& transformMatrix = states.transform.getMatrix();
+        if ((transformMatrix[0] * transformMatrix[5] - transformMatrix[1] * transformMatrix[4] != 0) && updateChildDrawBounds())
+        {
+            // A margin is added as the bounds of the children aren't calculated in exactly the same way as in drawWidget
+            const FloatRect clipRect = states.transform.getInverse().transformRect(target.getClipRect());
+            visibleRect = {clipRect.left - 1, clipRect.top - 1, clipRect.width + 2, clipRect.height + 2};
+            cullWidgets = true;
 
-            RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
+            if (m_childDrawBounds.sorted)
             {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
+                const bool vertical = m_childDrawBounds.sortedVertically;
+                const float visibleStart = vertical ? visibleRect.top : visibleRect.left;
+                const float visibleEnd = vertical ? (visibleRect.top + visibleRect.height) : (visibleRect.left + visibleRect.width);
+
+                // Widgets that start after the visible area can't be visible, nor can any of the widgets that follow them.
+                // Widgets before the first widget that ends inside or after the visible area can't be visible either.
+                const auto& bounds = m_childDrawBounds.bounds;
+                endIndex = static_cast<std::size_t>(std::partition_point(bounds.begin(), bounds.end(),
+                    [vertical,visibleEnd](const FloatRect& rect){ return (vertical ? rect.top : rect.left) <= visibleEnd; }) - bounds.begin());
+
+                const auto& maxEnds = m_childDrawBounds.maxEnds;
+                firstIndex = static_cast<std::size_t>(std::partition_point(maxEnds.begin(), maxEnds.end(),
+                    [visibleStart](float end){ return end < visibleStart; }) - maxEnds.begin());
             }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+        }
+
+        for (std::size_t i = firstIndex; i < endIndex; ++i)
+        {
+            const auto& widget = m_widgets[i];
+            if (!widget->isVisible())
+                continue;
+
+            if (cullWidgets)
             {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
+                const FloatRect& bounds = m_childDrawBounds.bounds[i];
+                if ((bounds.left > visibleRect.left + visibleRect.width) || (bounds.top > visibleRect.top + visibleRect.height)
+                 || (bounds.left + bounds.width < visibleRect.left) || (bounds.top + bounds.height < visibleRect.top))
+                    continue;
             }
 
+            RenderStates widgetStates = states;
+            widgetStates.transform.combine(widget->getTransform());
             target.drawWidget(widgetStates, widget);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Transform Container::getChildWidgetsAbsoluteTransform() const
+    {
+        Transform transform = getAbsoluteTransform();
+        transform.translate(getChildWidgetsOffset());
+        return transform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetsOffsetChanged()
+    {
+        for (const auto& widget : m_widgets)
+            widget->absoluteTransformChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1581,19 +1856,298 @@ namespace tgui
         if (!scaledOrRotated)
             return mousePos + origin;
 
-        const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-        const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-
-        Transform transform;
-        transform.translate(widget->getPosition() - origin);
-        transform.rotate(widget->getRotation(), rotOrigin);
-        transform.scale(widget->getScale(), scaleOrigin);
-        mousePos = transform.getInverse().transformPoint(mousePos);
+        mousePos = widget->getTransform().getInverse().transformPoint(mousePos);
         return mousePos + widget->getPosition();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect Container::getChildBounds(const Widget& widget, FloatRect area)
+    {
+        return widget.getTransform().transformRect(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateSpatialIndex() const
+    {
+        // Children that were only invalidated are moved within the grid, the index is only recreated when widgets were added,
+        // removed or reordered, or when a widget moved outside the area covered by the grid.
+        if (m_spatialIndex.valid && (m_spatialIndex.bounds.size() == m_widgets.size()))
+        {
+            for (const Widget* changedWidget : m_spatialIndex.changedWidgets)
+            {
+                const auto it = std::find_if(m_widgets.begin(), m_widgets.end(), [changedWidget](const Widget::Ptr& w){ return w.get() == changedWidget; });
+                if (it == m_widgets.end())
+                {
+                    m_spatialIndex.valid = false;
+                    break;
+                }
+
+                if (!m_spatialIndex.usable)
+                    continue;
+
+                const auto widgetIndex = static_cast<std::size_t>(it - m_widgets.begin());
+                const FloatRect newBounds = getChildBounds(**it, (*it)->getMouseHitArea());
+                const FloatRect& oldBounds = m_spatialIndex.bounds[widgetIndex];
+                if (newBounds == oldBounds)
+                    continue;
+
+                if ((newBounds.left < m_spatialIndex.area.left) || (newBounds.top < m_spatialIndex.area.top)
+                 || (newBounds.left + newBounds.width > m_spatialIndex.area.left + m_spatialIndex.area.width)
+                 || (newBounds.top + newBounds.height > m_spatialIndex.area.top + m_spatialIndex.area.height))
+                {
+                    m_spatialIndex.valid = false;
+                    break;
+                }
+
+                updateSpatialIndexCells(widgetIndex, oldBounds, false);
+                updateSpatialIndexCells(widgetIndex, newBounds, true);
+                m_spatialIndex.bounds[widgetIndex] = newBounds;
+            }
+
+            m_spatialIndex.changedWidgets.clear();
+        }
+        else
+            m_spatialIndex.valid = false;
+
+        if (!m_spatialIndex.valid)
+            rebuildSpatialIndex();
+
+        return m_spatialIndex.usable;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex() const
+    {
+        m_spatialIndex.valid = true;
+        m_spatialIndex.usable = false;
+        m_spatialIndex.changedWidgets.clear();
+        m_spatialIndex.cells.clear();
+        m_spatialIndex.bounds.resize(m_widgets.size());
+        if (m_widgets.empty())
+            return;
+
+        Vector2f minPos{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+        Vector2f maxPos{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const FloatRect bounds = getChildBounds(*m_widgets[i], m_widgets[i]->getMouseHitArea());
+            if (!std::isfinite(bounds.left) || !std::isfinite(bounds.top) || !std::isfinite(bounds.width) || !std::isfinite(bounds.height))
+                return;
+
+            m_spatialIndex.bounds[i] = bounds;
+            minPos.x = std::min(minPos.x, bounds.left);
+            minPos.y = std::min(minPos.y, bounds.top);
+            maxPos.x = std::max(maxPos.x, bounds.left + bounds.width);
+            maxPos.y = std::max(maxPos.y, bounds.top + bounds.height);
+        }
+
+        // Choose the amount of cells so that there are about as many cells as there are widgets
+        const float width = std::max(maxPos.x - minPos.x, 1.f);
+        const float height = std::max(maxPos.y - minPos.y, 1.f);
+        const float widgetCount = static_cast<float>(m_widgets.size());
+        constexpr float maxCellsPerAxis = 256;
+        m_spatialIndex.area = {minPos, {width, height}};
+        m_spatialIndex.columns = static_cast<std::size_t>(std::max(1.f, std::min(std::round(std::sqrt(widgetCount * width / height)), maxCellsPerAxis)));
+        m_spatialIndex.rows = static_cast<std::size_t>(std::max(1.f, std::min(std::round(std::sqrt(widgetCount * height / width)), maxCellsPerAxis)));
+        m_spatialIndex.cellSize = {width / static_cast<float>(m_spatialIndex.columns), height / static_cast<float>(m_spatialIndex.rows)};
+        m_spatialIndex.cells.resize(m_spatialIndex.columns * m_spatialIndex.rows);
+        m_spatialIndex.usable = true;
+
+        // The widgets are added from back to front, so the indices in each cell are sorted
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            updateSpatialIndexCells(i, m_spatialIndex.bounds[i], true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateSpatialIndexCells(std::size_t widgetIndex, FloatRect bounds, bool insert) const
+    {
+        const auto getCellIndex = [](float pos, float cellSize, std::size_t cellCount){
+            return std::min(static_cast<std::size_t>(std::max(0.f, pos / cellSize)), cellCount - 1);
+        };
+
+        const std::size_t firstColumn = getCellIndex(bounds.left - m_spatialIndex.area.left, m_spatialIndex.cellSize.x, m_spatialIndex.columns);
+        const std::size_t lastColumn = getCellIndex(bounds.left + bounds.width - m_spatialIndex.area.left, m_spatialIndex.cellSize.x, m_spatialIndex.columns);
+        const std::size_t firstRow = getCellIndex(bounds.top - m_spatialIndex.area.top, m_spatialIndex.cellSize.y, m_spatialIndex.rows);
+        const std::size_t lastRow = getCellIndex(bounds.top + bounds.height - m_spatialIndex.area.top, m_spatialIndex.cellSize.y, m_spatialIndex.rows);
+        for (std::size_t row = firstRow; row <= lastRow; ++row)
+        {
+            for (std::size_t column = firstColumn; column <= lastColumn; ++column)
+            {
+                auto& cell = m_spatialIndex.cells[(row * m_spatialIndex.columns) + column];
+                const auto it = std::lower_bound(cell.begin(), cell.end(), widgetIndex);
+                if (insert)
+                {
+                    if ((it == cell.end()) || (*it != widgetIndex))
+                        cell.insert(it, widgetIndex);
+                }
+                else if ((it != cell.end()) && (*it == widgetIndex))
+                    cell.erase(it);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetInvalidated(Widget* widget)
+    {
+        // The cached image of our children is outdated, and so are the images cached by the containers that contain us
+        for (Container* container = this; container != nullptr; container = container->getParent())
+            container->m_renderCacheValid = false;
+
+        if (m_spatialIndexEnabled && m_spatialIndex.valid)
+        {
+            // If many widgets change without the index being used, then it is cheaper to recreate it when it is needed again
+            if (m_spatialIndex.changedWidgets.size() >= m_widgets.size())
+            {
+                m_spatialIndex.valid = false;
+                m_spatialIndex.changedWidgets.clear();
+            }
+            else if (m_spatialIndex.changedWidgets.empty() || (m_spatialIndex.changedWidgets.back() != widget))
+                m_spatialIndex.changedWidgets.push_back(widget);
+        }
+
+        if (m_childDrawBounds.valid)
+        {
+            // Every changed widget has to be searched for, so the bounds are recalculated when too many widgets changed
+            if (m_childDrawBounds.changedWidgets.size() >= 16)
+            {
+                m_childDrawBounds.valid = false;
+                m_childDrawBounds.changedWidgets.clear();
+            }
+            else if (m_childDrawBounds.changedWidgets.empty() || (m_childDrawBounds.changedWidgets.back() != widget))
+                m_childDrawBounds.changedWidgets.push_back(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childRequestedTimeUpdates(Widget* widget)
+    {
+        const auto timeDependentIt = std::find_if(m_timeDependentWidgets.begin(), m_timeDependentWidgets.end(),
+            [widget](const Widget::Ptr& timeDependentWidget){ return timeDependentWidget.get() == widget; });
+        if (timeDependentIt == m_timeDependentWidgets.end())
+        {
+            const auto widgetIt = std::find_if(m_widgets.begin(), m_widgets.end(),
+                [widget](const Widget::Ptr& child){ return child.get() == widget; });
+            if (widgetIt == m_widgets.end())
+                return;
+
+            m_timeDependentWidgets.push_back(*widgetIt);
+        }
+
+        // Our parent has to keep calling our updateTime function, otherwise we can't update the child widget.
+        // We always pass the request on, as our parent may have stopped updating us while the widget was hidden.
+        requestTimeUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateChildDrawBounds() const
+    {
+        // Only the bounds of the children that reported a change (through childWidgetInvalidated) have to be recalculated
+        if (m_childDrawBounds.valid && (m_childDrawBounds.bounds.size() == m_widgets.size()))
+        {
+            bool boundsChanged = false;
+            for (const Widget* changedWidget : m_childDrawBounds.changedWidgets)
+            {
+                const auto it = std::find_if(m_widgets.begin(), m_widgets.end(), [changedWidget](const Widget::Ptr& w){ return w.get() == changedWidget; });
+                if (it == m_widgets.end())
+                {
+                    m_childDrawBounds.valid = false;
+                    break;
+                }
+
+                const FloatRect bounds = getChildBounds(**it, {(*it)->getWidgetOffset(), (*it)->getFullSize()});
+                if (!std::isfinite(bounds.left) || !std::isfinite(bounds.top) || !std::isfinite(bounds.width) || !std::isfinite(bounds.height))
+                {
+                    m_childDrawBounds.valid = false;
+                    break;
+                }
+
+                FloatRect& cachedBounds = m_childDrawBounds.bounds[static_cast<std::size_t>(it - m_widgets.begin())];
+                if (bounds != cachedBounds)
+                {
+                    cachedBounds = bounds;
+                    boundsChanged = true;
+                }
+            }
+
+            m_childDrawBounds.changedWidgets.clear();
+            if (m_childDrawBounds.valid)
+            {
+                if (boundsChanged)
+                    updateChildDrawBoundsOrder();
+
+                return true;
+            }
+        }
+
+        m_childDrawBounds.valid = false;
+        m_childDrawBounds.sorted = false;
+        m_childDrawBounds.changedWidgets.clear();
+        m_childDrawBounds.bounds.resize(m_widgets.size());
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const FloatRect bounds = getChildBounds(*m_widgets[i], {m_widgets[i]->getWidgetOffset(), m_widgets[i]->getFullSize()});
+            if (!std::isfinite(bounds.left) || !std::isfinite(bounds.top) || !std::isfinite(bounds.width) || !std::isfinite(bounds.height))
+                return false;
+
+            m_childDrawBounds.bounds[i] = bounds;
+        }
+
+        m_childDrawBounds.valid = true;
+        updateChildDrawBoundsOrder();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateChildDrawBoundsOrder() const
+    {
+        const auto& bounds = m_childDrawBounds.bounds;
+        bool sortedByTop = true;
+        bool sortedByLeft = true;
+        for (std::size_t i = 1; (i < bounds.size()) && (sortedByTop || sortedByLeft); ++i)
+        {
+            if (bounds[i].top < bounds[i-1].top)
+                sortedByTop = false;
+            if (bounds[i].left < bounds[i-1].left)
+                sortedByLeft = false;
+        }
+
+        // When the widgets are sorted in both directions (e.g. all in a single row), the direction in which they are spread out
+        // the most is used to search for the visible widgets.
+        m_childDrawBounds.sorted = (bounds.size() > 1) && (sortedByTop || sortedByLeft);
+        if (!m_childDrawBounds.sorted)
+        {
+            m_childDrawBounds.maxEnds.clear();
+            return;
+        }
+
+        if (sortedByTop && sortedByLeft)
+            m_childDrawBounds.sortedVertically = (bounds.back().top - bounds.front().top >= bounds.back().left - bounds.front().left);
+        else
+            m_childDrawBounds.sortedVertically = sortedByTop;
+
+        m_childDrawBounds.maxEnds.resize(bounds.size());
+        float maxEnd = -std::numeric_limits<float>::infinity();
+        for (std::size_t i = 0; i < bounds.size(); ++i)
+        {
+            if (m_childDrawBounds.sortedVertically)
+                maxEnd = std::max(maxEnd, bounds[i].top + bounds[i].height);
+            else
+                maxEnd = std::max(maxEnd, bounds[i].left + bounds[i].width);
+
+            m_childDrawBounds.maxEnds[i] = maxEnd;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::widgetAdded(const Widget::Ptr& widgetPtr)
     {
         if (widgetPtr->getParent())
@@ -120,6 +120,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> CustomWidgetForBindings::getTimeUntilNextUpdate() const
+    {
+        // We can't know when the custom update function needs to be called, so keep calling it at the same rate as before
+        const Optional<Duration> duration = Widget::getTimeUntilNextUpdate();
+        if (duration && (*duration < std::chrono::milliseconds(10)))
+            return duration;
+        else
+            return Duration{std::chrono::milliseconds(10)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
@@ -163,6 +175,9 @@ namespace tgui
     {
         Widget::mouseMoved(pos);
         implMouseMoved(pos);
+
+        // We can't know whether the handler changed how the widget looks
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
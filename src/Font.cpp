@@ -27,6 +27,10 @@
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -146,6 +150,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Font::getAdvance(char32_t codePoint, unsigned int characterSize, bool bold) const
+    {
+        if (m_backendFont)
+            return m_backendFont->getAdvance(codePoint, characterSize, bold);
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) const
     {
         if (m_backendFont)
@@ -156,6 +170,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::measureRuns(const StringView* runs, std::size_t runCount, unsigned int characterSize, bool bold, float* widths) const
+    {
+        if (m_backendFont)
+            m_backendFont->measureRuns(runs, runCount, characterSize, bold, widths);
+        else
+            std::fill(widths, widths + runCount, 0.f);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::prewarm(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges, const std::vector<unsigned int>& characterSizes,
+                       const std::vector<TextStyles>& styles) const
+    {
+        if (m_backendFont)
+            m_backendFont->prewarm(codePointRanges, characterSizes, styles);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getLineSpacing(unsigned int characterSize) const
     {
         if (m_backendFont)
@@ -217,30 +217,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool writeFile(const String& filename, CharStringView stringView)
+    static bool writeFileContents(const String& filename, const void* data, std::size_t size, bool binary)
     {
         // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
         // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
         // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
 #if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
         FILE* file = nullptr;
-        if (_wfopen_s(&file, filename.toWideString().c_str(), L"w") != 0)
+        if (_wfopen_s(&file, filename.toWideString().c_str(), binary ? L"wb" : L"w") != 0)
             return false;
 #elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
-        FILE* file = _wfopen(filename.toWideString().c_str(), L"w");
+        FILE* file = _wfopen(filename.toWideString().c_str(), binary ? L"wb" : L"w");
 #else
-        FILE* file = fopen(filename.toStdString().c_str(), "w");
+        FILE* file = fopen(filename.toStdString().c_str(), binary ? "wb" : "w");
 #endif
         if (!file)
             return false;
 
-        const bool success = (fwrite(stringView.data(), 1, stringView.size(), file) == stringView.size());
+        const bool success = (fwrite(data, 1, size, file) == size);
 
         (void)fclose(file);
         return success;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool writeFile(const String& filename, CharStringView stringView)
+    {
+        return writeFileContents(filename, stringView.data(), stringView.size(), false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool writeFile(const String& filename, const std::uint8_t* data, std::size_t size)
+    {
+        return writeFileContents(filename, data, size, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +49,7 @@ namespace tgui
     {
         Widget::setFocused(focused);
         m_container->setFocused(m_focused);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,6 +90,7 @@ namespace tgui
     {
         const bool isDragging = m_container->leftMousePressed(pos - getPosition());
         Widget::leftMousePressed(pos);
+        requestTimeUpdatesForSubwidgets();
         return isDragging;
     }
 
@@ -98,6 +100,7 @@ namespace tgui
     {
         m_container->leftMouseReleased(pos - getPosition());
         Widget::leftMouseReleased(pos);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +109,7 @@ namespace tgui
     {
         m_container->rightMousePressed(pos - getPosition());
         Widget::rightMousePressed(pos);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,6 +118,7 @@ namespace tgui
     {
         m_container->rightMouseReleased(pos - getPosition());
         Widget::rightMouseReleased(pos);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +135,7 @@ namespace tgui
     {
         m_container->keyPressed(event);
         Widget::keyPressed(event);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +144,7 @@ namespace tgui
     {
         m_container->textEntered(key);
         Widget::textEntered(key);
+        requestTimeUpdatesForSubwidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,6 +173,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t SubwidgetContainer::getHoverStateId() const
+    {
+        std::size_t id = Widget::getHoverStateId();
+        for (const auto& widget : m_container->getWidgets())
+            id = (id * 31) + widget->getHoverStateId();
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SubwidgetContainer::rightMouseButtonNoLongerDown()
     {
         m_container->rightMouseButtonNoLongerDown();
@@ -334,6 +352,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> SubwidgetContainer::getTimeUntilNextUpdate() const
+    {
+        const Optional<Duration> duration = Widget::getTimeUntilNextUpdate();
+        const Optional<Duration> containerDuration = m_container->getTimeUntilNextUpdate();
+        if (containerDuration && (!duration || (*containerDuration < *duration)))
+            return containerDuration;
+        else
+            return duration;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SubwidgetContainer::isMouseOnWidget(Vector2f pos) const
     {
         return m_container->isMouseOnWidget(pos - getPosition());
@@ -356,21 +386,8 @@ namespace tgui
             if (!widget->isVisible())
                 continue;
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
-
             RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
-            {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
-            }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
-            {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
-            }
-
+            widgetStates.transform.combine(widget->getTransform());
             target.drawWidget(widgetStates, widget);
         }
 
@@ -386,6 +403,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SubwidgetContainer::requestTimeUpdatesForSubwidgets()
+    {
+        if (m_container->getTimeUntilNextUpdate())
+            requestTimeUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,12 +30,180 @@
     #include <algorithm>
     #include <vector>
     #include <cmath>
+    #include <cstdint>
+    #include <limits>
+    #include <list>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct CachedParagraph
+        {
+            std::weak_ptr<BackendFont> font; // Used to detect that the font was destroyed and another one reuses its address
+            unsigned int fontMetricsVersion = 0;
+            float fontScale = 1;
+            unsigned int characterSize = 0;
+            bool bold = false;
+            String paragraph;
+            std::vector<std::size_t> breaks; // Positions within the paragraph where a new line starts
+            float minValidWidth = 0; // The breaks remain the same for any maximum width in [minValidWidth, maxValidWidth)
+            float maxValidWidth = 0;
+            std::size_t memoryUsage = 0;
+            std::list<std::uint64_t>::iterator lruPosition;
+        };
+
+        struct WordWrapCache
+        {
+            std::unordered_map<std::uint64_t, CachedParagraph> paragraphs;
+            std::list<std::uint64_t> lruList; // Most recently used paragraphs are at the front
+            std::size_t memoryUsage = 0;
+            std::size_t memoryLimit = 4 * 1024 * 1024;
+        };
+
+        TGUI_NODISCARD WordWrapCache& getWordWrapCache()
+        {
+            static WordWrapCache cache;
+            return cache;
+        }
+
+        TGUI_NODISCARD std::uint64_t hashParagraph(const BackendFont& font, unsigned int characterSize, bool bold, const char32_t* chars, std::size_t length)
+        {
+            // FNV-1a hash over the characters, combined with the other properties
+            std::uint64_t hash = 14695981039346656037ull;
+            const auto addValue = [&hash](std::uint64_t value){
+                hash ^= value;
+                hash *= 1099511628211ull;
+            };
+
+            for (std::size_t i = 0; i < length; ++i)
+                addValue(chars[i]);
+
+            addValue(reinterpret_cast<std::uintptr_t>(&font));
+            addValue(font.getMetricsVersion());
+            addValue(static_cast<std::uint64_t>(font.getFontScale() * 1000));
+            addValue((static_cast<std::uint64_t>(characterSize) << 1) | (bold ? 1 : 0));
+            return hash;
+        }
+
+        void removeCachedParagraph(WordWrapCache& cache, std::unordered_map<std::uint64_t, CachedParagraph>::iterator it)
+        {
+            cache.memoryUsage -= it->second.memoryUsage;
+            cache.lruList.erase(it->second.lruPosition);
+            cache.paragraphs.erase(it);
+        }
+
+        void evictParagraphs(WordWrapCache& cache)
+        {
+            while ((cache.memoryUsage > cache.memoryLimit) && !cache.lruList.empty())
+                removeCachedParagraph(cache, cache.paragraphs.find(cache.lruList.back()));
+        }
+
+        // Word-wraps a paragraph that contains no newline characters. The positions where new lines start are appended to
+        // breaks, and the range of maximum widths for which the wrapping would remain the same is returned via the last parameters.
+        void wordWrapParagraph(const char32_t* chars, std::size_t length, float maxWidth, const Font& font, unsigned int textSize, bool bold,
+                               std::vector<std::size_t>& breaks, float& minValidWidth, float& maxValidWidth)
+        {
+            minValidWidth = 0;
+            maxValidWidth = std::numeric_limits<float>::infinity();
+
+            const float tabWidth = font.getAdvance(U' ', textSize, bold) * 4;
+
+            // The line is filled greedily while remembering the last position where the line could be broken (the position
+            // directly behind a whitespace character) together with the width of the line up to that position. When a word
+            // doesn't fit on the line, the line is ended at that break opportunity and the width of the characters behind
+            // it is derived from the stored width instead of measuring those characters again.
+            std::size_t lineStart = 0;
+            std::size_t breakPos = 0; // Equal to lineStart when the current line has no break opportunity yet
+            float width = 0;
+            float widthAtBreakPos = 0;
+            float kerningAtBreakPos = 0;
+            char32_t prevChar = 0;
+            std::size_t index = 0;
+            while (index < length)
+            {
+                const char32_t curChar = chars[index];
+                if (curChar == U'\r')
+                {
+                    // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
+                    ++index;
+                    breakPos = index;
+                    widthAtBreakPos = width;
+                    kerningAtBreakPos = 0;
+                    continue;
+                }
+
+                const float charWidth = (curChar == U'\t') ? tabWidth : font.getAdvance(curChar, textSize, bold);
+                const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
+                const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
+
+                // We add the character to the line, unless a non-whitespace character exceeds the line length.
+                // We don't break on whitespace characters because having a space at the beginning of the line looks wrong.
+                // Every comparison with the maximum width narrows the range of widths for which the result would be identical.
+                const float requiredWidth = width + charWidth + kerning;
+                if (charIsWhitespace || (requiredWidth <= maxWidth))
+                {
+                    if (!charIsWhitespace)
+                        minValidWidth = std::max(minValidWidth, requiredWidth);
+
+                    // The kerning of the first character on a line is ignored, so remember it in case we break the line here
+                    if (index == breakPos)
+                        kerningAtBreakPos = kerning;
+
+                    width += kerning + charWidth;
+                    prevChar = curChar;
+                    ++index;
+
+                    if (isWhitespace(curChar))
+                    {
+                        breakPos = index;
+                        widthAtBreakPos = width;
+                        kerningAtBreakPos = 0;
+                    }
+                    continue;
+                }
+
+                maxValidWidth = std::min(maxValidWidth, requiredWidth);
+
+                if (index == lineStart)
+                {
+                    // We must always add at least one character to the line
+                    ++index;
+                    lineStart = index;
+                    breakPos = index;
+                    width = 0;
+                    prevChar = 0;
+                }
+                else if ((breakPos != lineStart) && !isWhitespace(curChar))
+                {
+                    // Move the last word to the next line. The character that didn't fit is checked again on the new line.
+                    width -= widthAtBreakPos + kerningAtBreakPos;
+                    if (breakPos == index)
+                        prevChar = 0;
+
+                    lineStart = breakPos;
+                }
+                else
+                {
+                    // If the entire word doesn't fit on the line then we have no other choice than to simply split the word
+                    lineStart = index;
+                    breakPos = index;
+                    width = 0;
+                    prevChar = 0;
+                }
+
+                breaks.push_back(lineStart);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Text::Text() :
         m_backendText(getBackend()->createText())
     {
@@ -284,28 +452,10 @@ namespace tgui
         if (font == nullptr)
             return 0.0f;
 
-        const bool bold = (textStyle & TextStyle::Bold) != 0;
-
+        // The font backend measures the text, which avoids a virtual function call for each character
+        const StringView textView = text;
         float width = 0.0f;
-        char32_t prevChar = 0;
-        for (const char32_t curChar : text)
-        {
-            float charWidth;
-            if (curChar == '\n')
-                break;
-            else if (curChar == U'\r')
-                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
-
-            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
-
-            width += charWidth + kerning;
-            prevChar = curChar;
-        }
-
+        font.measureRuns(&textView, 1, characterSize, (textStyle & TextStyle::Bold) != 0, &width);
         return width;
     }
 
@@ -353,78 +503,167 @@ namespace tgui
     String Text::wordWrap(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold)
     {
         String result;
-        if (font == nullptr)
+        const std::vector<LineSpan> lines = wordWrapSpans(maxWidth, text, font, textSize, bold);
+        if (lines.empty())
             return result;
 
-        std::size_t index = 0;
-        while (index < text.length())
+        result.reserve(text.length() + lines.size() - 1);
+        for (std::size_t i = 0; i < lines.size(); ++i)
         {
-            const std::size_t oldIndex = index;
+            if (i > 0)
+                result += U'\n';
 
-            // Find out how many characters we can get on this line
-            float width = 0;
-            char32_t prevChar = 0;
-            for (std::size_t i = index; i < text.length(); ++i)
-            {
-                float charWidth;
-                const char32_t curChar = text[i];
-                if (curChar == U'\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == U'\r')
-                {
-                    // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-                    index++;
-                    continue;
-                }
-                else if (curChar == U'\t')
-                    charWidth = font.getGlyph(U' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
+            result.append(text, lines[i].start, lines[i].length);
+        }
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
-                const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
+        return result;
+    }
 
-                // We add the character to the line, unless a non-whitespace character exceeds the line length.
-                // We don't break on whitespace characters because having a space at the beginning of the line looks wrong.
-                if ((maxWidth <= 0) || charIsWhitespace || (width + charWidth + kerning <= maxWidth))
-                {
-                    width += kerning + charWidth;
-                    index++;
-                }
-                else
-                    break;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                prevChar = curChar;
+    std::vector<Text::LineSpan> Text::wordWrapSpans(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold)
+    {
+        std::vector<LineSpan> lines;
+        if (font == nullptr)
+            return lines;
+
+        // Without a width limit we only need to split the text on its newline characters
+        if (maxWidth <= 0)
+        {
+            std::size_t lineStart = 0;
+            std::size_t newLinePos = text.find(U'\n');
+            while (newLinePos != String::npos)
+            {
+                lines.push_back({lineStart, newLinePos - lineStart});
+                lineStart = newLinePos + 1;
+                newLinePos = text.find(U'\n', lineStart);
             }
 
-            // We must always add at least one character to the line
-            if (index == oldIndex)
-                index++;
+            lines.push_back({lineStart, text.length() - lineStart});
+            return lines;
+        }
+
+        // Each paragraph (text between newlines) is wrapped separately. The result is cached together with the range of widths
+        // for which it remains valid, so that a paragraph only has to be wrapped again when its lines would actually change.
+        WordWrapCache& cache = getWordWrapCache();
+        const std::shared_ptr<BackendFont> backendFont = font.getBackendFont();
+        std::vector<std::size_t> breaks;
+        std::size_t paragraphStart = 0;
+        while (true)
+        {
+            std::size_t paragraphEnd = text.find(U'\n', paragraphStart);
+            const bool lastParagraph = (paragraphEnd == String::npos);
+            if (lastParagraph)
+                paragraphEnd = text.length();
+
+            const char32_t* paragraphChars = text.data() + paragraphStart;
+            const std::size_t paragraphLength = paragraphEnd - paragraphStart;
+            const std::vector<std::size_t>* paragraphBreaks = nullptr;
 
-            // Implement the word-wrap by removing the last few characters from the line
-            if (text[index-1] != U'\n')
+            std::uint64_t hash = 0;
+            if (cache.memoryLimit > 0)
             {
-                const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.length()) && (!isWhitespace(text[index])))
+                hash = hashParagraph(*backendFont, textSize, bold, paragraphChars, paragraphLength);
+                const auto it = cache.paragraphs.find(hash);
+                if (it != cache.paragraphs.end())
                 {
-                    while ((index > oldIndex) && !isWhitespace(text[index - 1]))
-                        index--;
+                    const CachedParagraph& cachedParagraph = it->second;
+                    if ((cachedParagraph.font.lock() == backendFont) && (cachedParagraph.fontMetricsVersion == backendFont->getMetricsVersion())
+                     && (cachedParagraph.fontScale == backendFont->getFontScale())
+                     && (cachedParagraph.characterSize == textSize) && (cachedParagraph.bold == bold)
+                     && (cachedParagraph.paragraph.length() == paragraphLength)
+                     && std::equal(paragraphChars, paragraphChars + paragraphLength, cachedParagraph.paragraph.data()))
+                    {
+                        if ((maxWidth >= cachedParagraph.minValidWidth) && (maxWidth < cachedParagraph.maxValidWidth))
+                        {
+                            cache.lruList.splice(cache.lruList.begin(), cache.lruList, cachedParagraph.lruPosition);
+                            paragraphBreaks = &cachedParagraph.breaks;
+                        }
+                    }
+                    else // Hash collision, the font changed or it was destroyed and another one reuses its address
+                        removeCachedParagraph(cache, it);
+                }
+            }
 
-                    // If the entire word doesn't fit on the line then we have no other choice than to simply split the word
-                    if (index == oldIndex)
-                        index = indexWithoutWordWrap;
+            if (!paragraphBreaks)
+            {
+                float minValidWidth;
+                float maxValidWidth;
+                breaks.clear();
+                wordWrapParagraph(paragraphChars, paragraphLength, maxWidth, font, textSize, bold, breaks, minValidWidth, maxValidWidth);
+                paragraphBreaks = &breaks;
+
+                if (cache.memoryLimit > 0)
+                {
+                    const auto it = cache.paragraphs.find(hash);
+                    if (it != cache.paragraphs.end())
+                        removeCachedParagraph(cache, it);
+
+                    CachedParagraph cachedParagraph;
+                    cachedParagraph.font = backendFont;
+                    cachedParagraph.fontMetricsVersion = backendFont->getMetricsVersion();
+                    cachedParagraph.fontScale = backendFont->getFontScale();
+                    cachedParagraph.characterSize = textSize;
+                    cachedParagraph.bold = bold;
+                    cachedParagraph.paragraph.assign(paragraphChars, paragraphLength);
+                    cachedParagraph.breaks = breaks;
+                    cachedParagraph.minValidWidth = minValidWidth;
+                    cachedParagraph.maxValidWidth = maxValidWidth;
+                    cachedParagraph.memoryUsage = sizeof(CachedParagraph) + sizeof(std::uint64_t)
+                        + (paragraphLength * sizeof(char32_t)) + (breaks.size() * sizeof(std::size_t));
+
+                    const auto insertResult = cache.paragraphs.emplace(hash, std::move(cachedParagraph));
+                    cache.lruList.push_front(hash);
+                    insertResult.first->second.lruPosition = cache.lruList.begin();
+                    cache.memoryUsage += insertResult.first->second.memoryUsage;
                 }
             }
 
-            result += text.substr(oldIndex, index - oldIndex);
-            if ((index < text.length()) && (text[index-1] != U'\n'))
-                result += U'\n';
+            std::size_t lineStart = 0;
+            for (const std::size_t lineBreak : *paragraphBreaks)
+            {
+                lines.push_back({paragraphStart + lineStart, lineBreak - lineStart});
+                lineStart = lineBreak;
+            }
+
+            // A line that ends at the end of the paragraph is only followed by an empty line when a newline comes after it
+            if ((lineStart < paragraphLength) || paragraphBreaks->empty() || !lastParagraph)
+                lines.push_back({paragraphStart + lineStart, paragraphLength - lineStart});
+
+            if (lastParagraph)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
         }
 
-        return result;
+        evictParagraphs(cache);
+        return lines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::setWordWrapCacheMemoryLimit(std::size_t bytes)
+    {
+        WordWrapCache& cache = getWordWrapCache();
+        cache.memoryLimit = bytes;
+        evictParagraphs(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Text::getWordWrapCacheMemoryLimit()
+    {
+        return getWordWrapCache().memoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::clearWordWrapCache()
+    {
+        WordWrapCache& cache = getWordWrapCache();
+        cache.paragraphs.clear();
+        cache.lruList.clear();
+        cache.memoryUsage = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -495,9 +734,9 @@ namespace tgui
                         const bool boldStyle = ((inputPiece.style & TextStyle::Bold) != 0);
                         TGUI_ASSERT(curChar != U'\n' && curChar != U'\r', "Newline characters must be removed before calling Text::wordWrap with blueprints")
                         if (curChar == U'\t')
-                            charWidth = font.getGlyph(U' ', inputPiece.characterSize, boldStyle).advance * 4;
+                            charWidth = font.getAdvance(U' ', inputPiece.characterSize, boldStyle) * 4;
                         else
-                            charWidth = font.getGlyph(curChar, inputPiece.characterSize, boldStyle).advance;
+                            charWidth = font.getAdvance(curChar, inputPiece.characterSize, boldStyle);
 
                         if (pieceCharIndex > 0)
                             kerning = font.getKerning(prevChar, curChar, inputPiece.characterSize, boldStyle);
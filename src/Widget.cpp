@@ -293,6 +293,8 @@ namespace tgui
             m_rotationDeg          = other.m_rotationDeg;
             m_prevPosition         = other.m_prevPosition;
             m_prevSize             = other.m_prevSize;
+            m_transformValid       = false;
+            m_absoluteTransformValid = false;
             m_boundPositionLayouts = {};
             m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
@@ -360,6 +362,8 @@ namespace tgui
             m_rotationDeg          = std::move(other.m_rotationDeg);
             m_prevPosition         = std::move(other.m_prevPosition);
             m_prevSize             = std::move(other.m_prevSize);
+            m_transformValid       = false;
+            m_absoluteTransformValid = false;
             m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
             m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
@@ -538,6 +542,9 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        if (m_containerWidget)
+            static_cast<Container*>(this)->childWidgetsOffsetChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -579,6 +586,13 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            // The cached transform has to be updated before the damaged areas are mapped through it
+            transformChanged();
+
+            // Both the old and the new area of the widget need to be redrawn
+            invalidateRect({getWidgetOffset() + m_prevPosition - getPosition(), getFullSize()});
+            invalidate();
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
@@ -599,6 +613,14 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            // The cached transform has to be updated before the damaged areas are mapped through it
+            transformChanged();
+
+            // Both the old and the new area of the widget need to be redrawn
+            const Vector2f sizeDiff = getSize() - m_prevSize;
+            invalidateRect({getWidgetOffset() + Vector2f{m_origin.x * sizeDiff.x, m_origin.y * sizeDiff.y}, getFullSize() - sizeDiff});
+            invalidate();
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
@@ -626,34 +648,61 @@ namespace tgui
 
     Vector2f Widget::getAbsolutePosition(Vector2f offset) const
     {
-        Vector2f pos = getPosition();
+        return getAbsoluteTransform().transformPoint(offset);
+    }
 
-        const bool defaultOrigin = (getOrigin().x == 0) && (getOrigin().y == 0);
-        const bool scaledOrRotated = (getScale().x != 1) || (getScale().y != 1) || (getRotation() != 0);
-        if (defaultOrigin && !scaledOrRotated)
-            pos += offset; // Optimization when there is no custom origin and no scaling or rotation
-        else
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Transform& Widget::getTransform() const
+    {
+        if (!m_transformValid)
         {
             const Vector2f origin{getOrigin().x * getSize().x, getOrigin().y * getSize().y};
-            if (!scaledOrRotated)
-                pos += offset - origin; // Optimization when there is no scaling or rotation
-            else
+
+            m_transform = Transform{};
+            m_transform.translate(getPosition() - origin);
+            if (getRotation() != 0)
             {
                 const Vector2f rotOrigin{getRotationOrigin().x * getSize().x, getRotationOrigin().y * getSize().y};
+                m_transform.rotate(getRotation(), rotOrigin);
+            }
+            if ((getScale().x != 1) || (getScale().y != 1))
+            {
                 const Vector2f scaleOrigin{getScaleOrigin().x * getSize().x, getScaleOrigin().y * getSize().y};
+                m_transform.scale(getScale(), scaleOrigin);
+            }
 
-                Transform transform;
-                transform.translate(-origin);
-                transform.rotate(getRotation(), rotOrigin);
-                transform.scale(getScale(), scaleOrigin);
-                pos += transform.transformPoint(offset);
+            m_transformValid = true;
+        }
+
+        return m_transform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Transform& Widget::getAbsoluteTransform() const
+    {
+        if (!m_absoluteTransformValid)
+        {
+            if (m_parent)
+            {
+                m_absoluteTransform = m_parent->getChildWidgetsAbsoluteTransform();
+                m_absoluteTransform.combine(getTransform());
             }
+            else
+                m_absoluteTransform = getTransform();
+
+            m_absoluteTransformValid = true;
         }
 
-        if (m_parent)
-            return m_parent->getAbsolutePosition(pos + m_parent->getChildWidgetsOffset());
-        else
-            return pos;
+        return m_absoluteTransform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Widget::getAbsoluteBounds() const
+    {
+        return getAbsoluteTransform().transformRect({getWidgetOffset(), getFullSize()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -683,23 +732,41 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        if (origin == m_origin)
+            return;
+
+        invalidate();
         m_origin = origin;
+        transformChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        if ((scaleFactors == m_scaleFactors) && !m_scaleOrigin)
+            return;
+
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        transformChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        if ((scaleFactors == m_scaleFactors) && m_scaleOrigin && (*m_scaleOrigin == origin))
+            return;
+
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        transformChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -716,16 +783,28 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        if ((angle == m_rotationDeg) && !m_rotationOrigin)
+            return;
+
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        transformChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        if ((angle == m_rotationDeg) && m_rotationOrigin && (*m_rotationOrigin == origin))
+            return;
+
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        transformChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -852,6 +931,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -972,6 +1053,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -984,6 +1067,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Move); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -996,13 +1081,27 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Resize); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setVisible(bool visible)
     {
-        m_visible = visible;
+        if (m_visible != visible)
+        {
+            m_visible = visible;
+            invalidate();
+
+            // The parent may have to add the widget to or remove it from its spatial index
+            if (m_parent)
+                m_parent->childWidgetInvalidated(this);
+
+            // Hidden widgets aren't updated, so an animation may still be pending
+            if (visible)
+                requestTimeUpdates();
+        }
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -1025,6 +1124,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidate();
 
         if (!enabled)
         {
@@ -1045,6 +1145,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidate();
+
         if (focused)
         {
             if (canGainFocus())
@@ -1055,7 +1157,13 @@ namespace tgui
                     m_parent->childWidgetFocused(shared_from_this());
 
                 if (m_focused) // Might be altered by childWidgetFocused if the parent is disabled
+                {
+                    // Focused widgets may need to be updated over time (e.g. a blinking caret)
+                    if (getTimeUntilNextUpdate())
+                        requestTimeUpdates();
+
                     onFocus.emit(this);
+                }
             }
         }
         else // Unfocusing widget
@@ -1081,6 +1189,74 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        invalidateRect({getWidgetOffset(), getFullSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::transformChanged()
+    {
+        m_transformValid = false;
+        absoluteTransformChanged();
+
+        // The parent caches the bounds of its children, both in its spatial index and to skip drawing children outside the
+        // visible area. This is called from setPosition and setSize as well, so the bounds are updated even when the widget
+        // doesn't invalidate itself.
+        if (m_parent)
+            m_parent->childWidgetInvalidated(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::absoluteTransformChanged()
+    {
+        // If the transform was already outdated then the transforms of the child widgets are outdated as well
+        if (!m_absoluteTransformValid)
+            return;
+
+        m_absoluteTransformValid = false;
+        if (m_containerWidget)
+            static_cast<Container*>(this)->childWidgetsOffsetChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Widget::getMouseHitArea() const
+    {
+        return {getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateRect(FloatRect rect)
+    {
+        // The parent has to redraw its cached image and check whether the widget moved before its spatial index or cached
+        // child bounds are used again
+        if (m_parent)
+            m_parent->childWidgetInvalidated(this);
+
+        if (!m_parentGui || !m_parentGui->isDamageTrackingEnabled())
+            return;
+
+        // We don't calculate the area that is affected when the widget or one of its parents is rotated or scaled
+        for (const Widget* widget = this; widget != nullptr; widget = widget->getParent())
+        {
+            if ((widget->getRotation() != 0) || (widget->getScale().x != 1) || (widget->getScale().y != 1))
+            {
+                m_parentGui->invalidate();
+                return;
+            }
+        }
+
+        // A small margin is added because the position gets rounded to whole pixels when the widget is drawn
+        const Vector2f absolutePos = getAbsolutePosition({rect.left, rect.top});
+        m_parentGui->invalidateRect({absolutePos.x - 1, absolutePos.y - 1, rect.width + 2, rect.height + 2});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::moveToFront()
     {
         if (m_parent)
@@ -1101,6 +1277,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1116,6 +1293,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1137,6 +1315,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1337,6 +1516,11 @@ namespace tgui
             SignalManager::getSignalManager()->add(shared_from_this());
 
         m_parent = parent;
+        absoluteTransformChanged();
+
+        // The new parent calls updateTime at least once, it keeps doing so while the widget changes or has a pending update
+        if (parent)
+            requestTimeUpdates();
 
         // Give the layouts another chance to find widgets to which it refers
         if (parent)
@@ -1368,6 +1552,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Widget::getTimeUntilNextUpdate() const
+    {
+        // Animations have to be updated every frame
+        if (!m_showAnimations.empty())
+            return Duration{};
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Widget::combineTimeUntilNextUpdate(Optional<Duration> duration, Duration elapsedTime, const Optional<Duration>& deadline)
+    {
+        if (!deadline)
+            return duration;
+
+        const Duration timeLeft = (elapsedTime < *deadline) ? *deadline - elapsedTime : Duration{};
+        if (!duration || (timeLeft < *duration))
+            duration = timeLeft;
+
+        return duration;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestTimeUpdates()
+    {
+        if (m_parent)
+            m_parent->childRequestedTimeUpdates(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setAutoLayoutUpdateEnabled(bool enabled)
     {
         m_autoLayoutUpdateEnabled = enabled;
@@ -1474,6 +1691,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Widget::getHoverStateId() const
+    {
+        return m_mouseHover ? 1 : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Widget::askToolTip(Vector2f mousePos)
     {
         if (m_toolTip && isMouseOnWidget(mousePos))
@@ -1862,6 +2086,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1873,6 +2098,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_parent->getMouseCursor());
 
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -1925,6 +2151,11 @@ namespace tgui
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+        invalidate();
+
+        // Properties such as borders and padding can change the position of the child widgets
+        if (m_containerWidget)
+            static_cast<Container*>(this)->childWidgetsOffsetChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
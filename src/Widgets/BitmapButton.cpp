@@ -149,6 +149,7 @@ namespace tgui
             m_imageComponent->setVisible(false);
 
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +165,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +215,7 @@ namespace tgui
         m_textComponent->setString(caption);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +232,7 @@ namespace tgui
         m_textPosition = position;
         m_textOrigin = origin;
         updateTextPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +493,7 @@ namespace tgui
 
         m_backgroundComponent->setComponentState(m_state);
         m_textComponent->setComponentState(m_state);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +288,7 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         m_linesStartFromTop = startFromTop;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +303,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +318,7 @@ namespace tgui
     void ChatBox::setScrollbarValue(unsigned int value)
     {
         m_scrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +402,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ChatBox::getHoverStateId() const
+    {
+        return (Widget::getHoverStateId() * 31) + m_scrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ChatBox::scrolled(float delta, Vector2f pos, bool touch)
     {
         if (m_scrollbar->getViewportSize() < m_scrollbar->getMaximum())
@@ -453,6 +463,8 @@ namespace tgui
                 m_scrollbar->setValue(m_scrollbar->getMaximum() - m_scrollbar->getViewportSize());
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
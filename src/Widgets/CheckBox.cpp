@@ -154,6 +154,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidate();
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
@@ -467,6 +467,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -506,6 +507,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -611,6 +613,9 @@ namespace tgui
     void ChildWindow::setResizable(bool resizable)
     {
         m_resizable = resizable;
+
+        // The area around the window in which the mouse can interact with the borders changed
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -676,9 +681,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ChildWindow::isMouseOnWidget(Vector2f pos) const
+    FloatRect ChildWindow::getMouseHitArea() const
     {
-        FloatRect region{getPosition(), getSize()};
+        FloatRect region{0, 0, getSize().x, getSize().y};
 
         // Expand the region if the child window is resizable (to make the borders easier to click on)
         if (m_resizable)
@@ -691,6 +696,17 @@ namespace tgui
                              + std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getBottom());
         }
 
+        return region;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChildWindow::isMouseOnWidget(Vector2f pos) const
+    {
+        FloatRect region = getMouseHitArea();
+        region.left += getPosition().x;
+        region.top += getPosition().y;
+
         if (region.contains(pos))
         {
             // If the mouse enters the border or title bar then then none of the widgets can still be under the mouse
@@ -997,6 +1013,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ChildWindow::getHoverStateId() const
+    {
+        std::size_t id = Container::getHoverStateId();
+        for (const auto* button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+            id = (id * 31) + button->getHoverStateId();
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::updateTitleBarHeight()
     {
         m_spriteTitleBar.setSize({getClientSize().x, m_titleBarHeightCached});
@@ -1024,6 +1051,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,6 +301,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -316,6 +317,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -331,6 +333,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -343,6 +346,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->deselectItem();
     }
 
@@ -355,6 +359,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -384,6 +389,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -397,6 +403,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -457,6 +464,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -466,6 +474,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -475,6 +484,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -520,6 +530,7 @@ namespace tgui
         m_listBox->setTextSize(m_textSizeCached);
         m_text.setCharacterSize(m_textSizeCached);
         m_defaultText.setCharacterSize(m_textSizeCached);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +538,7 @@ namespace tgui
     void ComboBox::setDefaultText(const String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -651,6 +663,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(nextIndex);
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidate();
                 onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -661,6 +674,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidate();
                 onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -1010,6 +1024,7 @@ namespace tgui
         if (selectedItemIndex != m_previousSelectedItemIndex)
         {
             m_text.setString(m_listBox->getSelectedItem());
+            invalidate();
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
         }
     }
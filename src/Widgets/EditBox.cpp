@@ -174,6 +174,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,6 +491,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            requestTimeUpdates();
         }
 
         // The caret should be visible
@@ -1052,9 +1054,9 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getAdvance(curChar, textSize, bold);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize, bold);
             if (width + charWidth < posX)
@@ -1197,6 +1199,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
             const FloatRect inputRect = {absoluteTextPos, getAbsolutePosition({textPos.x, textPos.y + m_textFull.getSize().y}) - absoluteTextPos};
             m_parentGui->updateTextCursorPosition(inputRect, getAbsolutePosition({caretLeft + m_caret.getSize().x, textY}));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1278,6 +1282,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
             m_textAfterSelection.setColor(getSharedRenderer()->getTextColor());
             m_textSuffix.setColor(getSharedRenderer()->getTextColor());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1359,6 +1365,14 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> EditBox::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(ClickableWidget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_focused ? Optional<Duration>{getEditCursorBlinkRate()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::backspaceKeyPressed()
     {
         if (m_readOnly)
@@ -277,6 +277,7 @@ namespace tgui
     void EditBoxSlider::setTextAlignment(HorizontalAlignment alignment)
     {
         m_editBox->setAlignment(alignment);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +360,7 @@ namespace tgui
     void EditBoxSlider::setString(const String& str)
     {
         m_editBox->setText(str);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
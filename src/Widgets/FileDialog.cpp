@@ -200,6 +200,7 @@ namespace tgui
         m_fileTypeFilters       {std::move(other.m_fileTypeFilters)},
         m_selectedFileTypeFilter{std::move(other.m_selectedFileTypeFilter)},
         m_iconLoader            {std::move(other.m_iconLoader)},
+        m_fileIconsRequested    {std::move(other.m_fileIconsRequested)},
         m_selectedFiles         {std::move(other.m_selectedFiles)}
     {
         connectSignals();
@@ -228,6 +229,7 @@ namespace tgui
             m_fileTypeFilters = other.m_fileTypeFilters;
             m_selectedFileTypeFilter = other.m_selectedFileTypeFilter;
             m_iconLoader = FileDialogIconLoader::createInstance();
+            m_fileIconsRequested = false;
             m_selectedFiles = other.m_selectedFiles;
 
             identifyChildWidgets();
@@ -272,6 +274,7 @@ namespace tgui
             m_fileTypeFilters = std::move(other.m_fileTypeFilters);
             m_selectedFileTypeFilter = std::move(other.m_selectedFileTypeFilter);
             m_iconLoader = std::move(other.m_iconLoader);
+            m_fileIconsRequested = std::move(other.m_fileIconsRequested);
             m_selectedFiles = std::move(other.m_selectedFiles);
             ChildWindow::operator=(std::move(other));
 
@@ -580,6 +583,7 @@ namespace tgui
     {
         TGUI_ASSERT(iconLoader != nullptr, "Icon loader can't be a nullptr");
         m_iconLoader = std::move(iconLoader);
+        m_fileIconsRequested = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -669,6 +673,7 @@ namespace tgui
         if (!m_iconLoader->update())
             return childWidgetUpdated;
 
+        m_fileIconsRequested = false;
         m_fileIcons = m_iconLoader->retrieveFileIcons();
 
         const int oldSelectedItem = m_listView->getSelectedItemIndex();
@@ -681,6 +686,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> FileDialog::getTimeUntilNextUpdate() const
+    {
+        Optional<Duration> duration = ChildWindow::getTimeUntilNextUpdate();
+
+        // The icon loader can't notify us when its thread finished, so we have to keep polling while icons are being loaded
+        if (m_fileIconsRequested && (!duration || (*duration > std::chrono::milliseconds(10))))
+            duration = Duration{std::chrono::milliseconds(10)};
+
+        return duration;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FileDialog::changePath(const Filesystem::Path& path, bool updateHistory)
     {
         if (updateHistory && (m_currentDirectory != path))
@@ -736,6 +754,9 @@ namespace tgui
         }
 
         m_iconLoader->requestFileIcons(m_filesInDirectory);
+        m_fileIconsRequested = m_iconLoader->supportsSystemIcons();
+        if (m_fileIconsRequested)
+            requestTimeUpdates();
 
         m_listView->getVerticalScrollbar()->setValue(0);
         sortFilesInListView();
@@ -185,6 +185,7 @@ namespace tgui
     void Label::setScrollbarValue(unsigned int value)
     {
         m_scrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +318,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    requestTimeUpdates();
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -373,6 +375,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Label::getHoverStateId() const
+    {
+        return (ClickableWidget::getHoverStateId() * 31) + m_scrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& Label::getSignal(String signalName)
     {
         if (signalName == onDoubleClick.getName())
@@ -571,6 +580,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Label::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::scrollbarPolicyChanged()
     {
         // The scrollbar policy only has an effect when not auto-sizing
@@ -582,6 +599,7 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        invalidate();
         m_lines.clear();
 
         if (m_fontCached == nullptr)
@@ -608,18 +626,14 @@ namespace tgui
         }
 
         // Fit the text in the available space
-        Optional<String> wordWrappedString = (maxWidth > 0)
-            ? Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold)
-            : Optional<String>();
-        String* stringPtr = wordWrappedString.has_value() ? &wordWrappedString.value() : &m_string;
+        std::vector<Text::LineSpan> lineSpans = Text::wordWrapSpans(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
                                  m_paddingCached.getRight() + m_bordersCached.getRight(),
                                  m_paddingCached.getBottom() + m_bordersCached.getBottom()};
 
-        const auto lineCount = std::count(stringPtr->begin(), stringPtr->end(), U'\n') + 1;
-        float requiredTextHeight = (lineCount - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
+        float requiredTextHeight = static_cast<float>(lineSpans.size() - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
                                  + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_fontCached.getLineSpacing(m_textSizeCached))
                                  + Text::getExtraVerticalPadding(m_textSizeCached);
 
@@ -633,11 +647,8 @@ namespace tgui
                 if (maxWidth <= 0)
                     return;
 
-                wordWrappedString = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
-                stringPtr = &wordWrappedString.value();
-
-                const auto newLineCount = std::count(stringPtr->begin(), stringPtr->end(), U'\n') + 1;
-                requiredTextHeight = (newLineCount - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
+                lineSpans = Text::wordWrapSpans(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
+                requiredTextHeight = static_cast<float>(lineSpans.size() - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
                                    + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_fontCached.getLineSpacing(m_textSizeCached))
                                    + Text::getExtraVerticalPadding(m_textSizeCached);
             }
@@ -650,12 +661,9 @@ namespace tgui
 
         // Split the string in multiple lines
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != String::npos)
+        m_lines.reserve(lineSpans.size());
+        for (const auto& lineSpan : lineSpans)
         {
-            newLinePos = stringPtr->find('\n', searchPosStart);
-
             TGUI_EMPLACE_BACK(line, m_lines)
             TGUI_EMPLACE_BACK(textPiece, line)
             textPiece.setCharacterSize(getTextSize());
@@ -666,15 +674,10 @@ namespace tgui
             textPiece.setOutlineColor(m_textOutlineColorCached);
             textPiece.setOutlineThickness(m_textOutlineThicknessCached);
 
-            if (newLinePos != String::npos)
-                textPiece.setString(stringPtr->substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                textPiece.setString(stringPtr->substr(searchPosStart));
+            textPiece.setString(m_string.substr(lineSpan.start, lineSpan.length));
 
             if (textPiece.getSize().x > width)
                 width = textPiece.getSize().x;
-
-            searchPosStart = newLinePos + 1;
         }
 
         // Update the size of the label
@@ -289,6 +289,7 @@ namespace tgui
 
         m_scrollbar->setMaximum(0);
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +400,7 @@ namespace tgui
             return false;
 
         m_items[index].text.setString(newValue);
+        invalidate();
         return true;
     }
 
@@ -493,6 +495,7 @@ namespace tgui
     void ListBox::scrollbarValueChanged()
     {
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +548,7 @@ namespace tgui
     void ListBox::setTextAlignment(HorizontalAlignment alignment)
     {
         m_textAlignment = alignment;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +578,7 @@ namespace tgui
     {
         m_scrollbar->setValue(value);
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -677,6 +682,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
 
@@ -772,6 +778,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListBox::getHoverStateId() const
+    {
+        return (Widget::getHoverStateId() * 31) + m_scrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::keyPressed(const Event::KeyEvent& event)
     {
         Widget::keyPressed(event);
@@ -1066,6 +1079,7 @@ namespace tgui
             m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
 
         m_scrollbar->setPosition(getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1089,6 +1103,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1184,6 +1200,7 @@ namespace tgui
         m_items.emplace_back();
         m_items.back().text = std::move(newItem);
         m_items.back().id = id;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1203,6 +1220,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> ListBox::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -271,7 +271,10 @@ namespace tgui
     void ListView::setColumnAlignment(std::size_t columnIndex, HorizontalAlignment alignment)
     {
         if (columnIndex < m_columns.size())
+        {
             m_columns[columnIndex].alignment = alignment;
+            invalidate();
+        }
         else
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
@@ -893,6 +896,8 @@ namespace tgui
 
         if (updateWidestItemInColumn(0, index))
             updateColumnWidths();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -982,6 +987,7 @@ namespace tgui
 
         // While the width of the widest item didn't change, its index might have, so we need to locate it again
         updateWidestItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1268,6 +1274,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1289,6 +1296,7 @@ namespace tgui
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1435,6 +1443,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
         // Check if the header was clicked
@@ -1659,6 +1668,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListView::getHoverStateId() const
+    {
+        return (((Widget::getHoverStateId() * 31) + m_verticalScrollbar->getHoverStateId()) * 31) + m_horizontalScrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::keyPressed(const Event::KeyEvent& event)
     {
         Widget::keyPressed(event);
@@ -2185,6 +2201,8 @@ namespace tgui
     {
         for (auto& text : m_items[index].texts)
             text.setColor(color);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2234,6 +2252,8 @@ namespace tgui
             else
                 column.text.setColor(m_textColorCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2751,6 +2771,8 @@ namespace tgui
             if (hasExpandedColumn())
                 updateColumnWidths();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2886,6 +2908,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> ListView::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -350,6 +350,7 @@ namespace tgui
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,6 +382,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidate();
         return true;
     }
 
@@ -396,6 +398,7 @@ namespace tgui
             return false;
 
         menu->text.setString(text);
+        invalidate();
         return true;
     }
 
@@ -404,6 +407,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +421,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidate();
             return true;
         }
 
@@ -438,7 +443,11 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        if (!removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus))
+            return false;
+
+        invalidate();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -455,7 +464,11 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        return removeSubMenusImpl(hierarchy, 0, m_menus);
+        if (!removeSubMenusImpl(hierarchy, 0, m_menus))
+            return false;
+
+        invalidate();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1113,6 +1126,11 @@ namespace tgui
             menu.text.setColor(m_selectedTextColorCached);
         else
             menu.text.setColor(m_textColorCached);
+
+        // The open menus are drawn by the placeholder widget instead of by the menu bar itself
+        invalidate();
+        if (m_menuWidgetPlaceholder->getParent())
+            m_menuWidgetPlaceholder->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
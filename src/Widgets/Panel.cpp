@@ -179,6 +179,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
     }
@@ -322,6 +323,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Panel::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Group::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
@@ -158,6 +158,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
     }
@@ -233,6 +234,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Picture::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(BackendRenderTarget& target, RenderStates states) const
     {
         target.drawSprite(states, m_sprite);
@@ -213,6 +213,7 @@ namespace tgui
         m_textFront.setString(text);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -469,6 +470,8 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +162,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,7 +173,11 @@ namespace tgui
         if (m_text.getString() == text)
             return;
 
+        // The full size depends on the text, so both the old and the new area of the widget need to be redrawn
+        invalidate();
         m_text.setString(text);
+        invalidate();
+
         onSizeChange.emit(this, getSize());
     }
 
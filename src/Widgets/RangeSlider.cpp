@@ -695,6 +695,8 @@ namespace tgui
             if (m_spriteSelectedTrackHover.isSet())
                 m_spriteSelectedTrackHover.setVisibleRect(m_spriteSelectedTrack.getVisibleRect());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +90,7 @@ namespace tgui
 
     void RichTextLabel::rearrangeText()
     {
+        invalidate();
         if (m_fontCached == nullptr)
         {
             m_lines.clear();
@@ -48,6 +48,8 @@ namespace tgui
             m_renderer = aurora::makeCopied<ScrollablePanelRenderer>();
             setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
         }
+
+        connectScrollbarValueChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +68,8 @@ namespace tgui
         m_connectedPositionCallbacks{},
         m_connectedSizeCallbacks    {}
     {
+        connectScrollbarValueChange();
+
         if (m_contentSize == Vector2f{0, 0})
         {
             for (const auto& widget : m_widgets)
@@ -90,6 +94,7 @@ namespace tgui
         m_connectedSizeCallbacks    {std::move(other.m_connectedSizeCallbacks)}
     {
         disconnectAllChildWidgets();
+        connectScrollbarValueChange();
 
         if (m_contentSize == Vector2f{0, 0})
         {
@@ -116,6 +121,7 @@ namespace tgui
             m_stuckInUpdateScrollbars = false;
 
             disconnectAllChildWidgets();
+            connectScrollbarValueChange();
 
             if (m_contentSize == Vector2f{0, 0})
             {
@@ -145,6 +151,7 @@ namespace tgui
             DualScrollbarChildInterface::operator=(std::move(other));
 
             disconnectAllChildWidgets();
+            connectScrollbarValueChange();
 
             if (m_contentSize == Vector2f{0, 0})
             {
@@ -217,6 +224,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Transform ScrollablePanel::getChildWidgetsAbsoluteTransform() const
+    {
+        Transform transform = Panel::getChildWidgetsAbsoluteTransform();
+        transform.translate(-getContentOffset());
+        return transform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::add(const Widget::Ptr& widget, const String& widgetName)
     {
         Panel::add(widget, widgetName);
@@ -618,6 +634,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ScrollablePanel::getHoverStateId() const
+    {
+        return (((Panel::getHoverStateId() * 31) + m_verticalScrollbar->getHoverStateId()) * 31) + m_horizontalScrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr ScrollablePanel::askToolTip(Vector2f mousePos)
     {
         if (isMouseOnWidget(mousePos))
@@ -691,10 +714,11 @@ namespace tgui
         {
             target.addClippingLayer(states, {{}, contentSize});
 
-            states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()),
-                                        -static_cast<float>(m_verticalScrollbar->getValue())});
+            const Vector2f scrollOffset{static_cast<float>(m_horizontalScrollbar->getValue()),
+                                        static_cast<float>(m_verticalScrollbar->getValue())};
+            states.transform.translate(-scrollOffset);
 
-            Container::draw(target, states); // NOLINT(bugprone-parent-virtual-call)
+            drawChildWidgets(target, states, {scrollOffset, contentSize});
             target.removeClippingLayer();
         }
 
@@ -866,6 +890,8 @@ namespace tgui
             m_recalculatingSizeDuringUpdateScrollbars = false;
             m_stuckInUpdateScrollbars = false;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -911,6 +937,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::connectScrollbarValueChange()
+    {
+        m_verticalScrollbar->onValueChange.disconnectAll();
+        m_verticalScrollbar->onValueChange([this]{ childWidgetsOffsetChanged(); invalidate(); });
+
+        m_horizontalScrollbar->onValueChange.disconnectAll();
+        m_horizontalScrollbar->onValueChange([this]{ childWidgetsOffsetChanged(); invalidate(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr ScrollablePanel::clone() const
     {
         return std::make_shared<ScrollablePanel>(*this);
@@ -240,6 +240,8 @@ namespace tgui
 
             rightMouseButtonNoLongerDown();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -720,6 +722,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Scrollbar::getHoverStateId() const
+    {
+        return (Widget::getHoverStateId() * 4) + static_cast<std::size_t>(m_mouseHoverOverPart);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Scrollbar::updateSize()
     {
         if (!m_orientationLocked)
@@ -1059,6 +1068,8 @@ namespace tgui
             else
                 m_thumb.left = m_track.left;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1384,12 +1395,18 @@ namespace tgui
 
     void ScrollbarChildInterface::scrollbarValueChanged()
     {
+        // The widget that owns the scrollbar has to be redrawn
+        if (auto* widget = dynamic_cast<Widget*>(this))
+            widget->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollbarChildInterface::scrollbarPolicyChanged()
     {
+        // The widget that owns the scrollbar has to be redrawn
+        if (auto* widget = dynamic_cast<Widget*>(this))
+            widget->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1522,12 +1539,18 @@ namespace tgui
 
     void DualScrollbarChildInterface::scrollbarValueChanged(Orientation)
     {
+        // The widget that owns the scrollbar has to be redrawn
+        if (auto* widget = dynamic_cast<Widget*>(this))
+            widget->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void DualScrollbarChildInterface::scrollbarPolicyChanged(Orientation)
     {
+        // The widget that owns the scrollbar has to be redrawn
+        if (auto* widget = dynamic_cast<Widget*>(this))
+            widget->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,6 +695,8 @@ namespace tgui
             if (m_invertedDirection)
                 m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,6 +238,7 @@ namespace tgui
 
         m_orientation = orientation;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -321,6 +322,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t SpinButton::getHoverStateId() const
+    {
+        return (ClickableWidget::getHoverStateId() * 2) + (m_mouseHoverOnTopArrow ? 1 : 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& SpinButton::getSignal(String signalName)
     {
         if (signalName == onValueChange.getName())
@@ -285,6 +285,7 @@ namespace tgui
     {
         m_useWideArrows = useWideArrows;
         setSize(m_size);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,6 +375,7 @@ namespace tgui
     void SpinControl::setString(const String& str)
     {
         m_spinText->setText(str);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +310,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t SplitContainer::getHoverStateId() const
+    {
+        return (Group::getHoverStateId() * 2) + (m_mouseHoverOnSplitter ? 1 : 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SplitContainer::draw(BackendRenderTarget& target, RenderStates states) const
     {
         Group::draw(target, states);
@@ -493,6 +500,8 @@ namespace tgui
             m_widgets[1]->setSize({innerSize.x, availableSize - m_splitterWidth - m_currentSplitterOffset});
             m_widgets[1]->setPosition({0, m_currentSplitterOffset + m_splitterWidth});
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
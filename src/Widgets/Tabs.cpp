@@ -547,6 +547,7 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -808,6 +809,8 @@ namespace tgui
                     m_tabs[static_cast<std::size_t>(m_hoveringTab)].text.setColor(m_textColorHoverCached);
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include <TGUI/Keyboard.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
 #endif
 
@@ -162,6 +163,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,6 +431,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,6 +453,7 @@ namespace tgui
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +564,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
 
             // If the caret position changed, emit signal.
@@ -688,6 +693,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t TextArea::getHoverStateId() const
+    {
+        return (((Widget::getHoverStateId() * 31) + m_verticalScrollbar->getHoverStateId()) * 31) + m_horizontalScrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::keyPressed(const Event::KeyEvent& event)
     {
         if (event.code == Event::KeyboardKey::Tab)
@@ -925,9 +937,9 @@ namespace tgui
             //    return Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextArea strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == U'\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getAdvance(curChar, getTextSize(), false);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize(), false);
             if (width + charWidth + kerning <= position.x)
@@ -1362,24 +1374,23 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        String string;
-        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbar->getPolicy() == Scrollbar::Policy::Never)
         {
             // Find the maximum width of one line
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
             if (m_verticalScrollbar->isShown())
                 maxLineWidth -= m_verticalScrollbar->getSize().x;
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
         }
 
+        // Find where each line starts and ends in the text. When there is no maximum width, this only splits on newlines.
+        const std::vector<Text::LineSpan> lineSpans = Text::wordWrapSpans(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
+
         // Store the current selection position when we are keeping the selection
         const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
         const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
@@ -1387,42 +1398,37 @@ namespace tgui
         // Split the string in multiple lines
         m_maxLineWidth = 0;
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
+        m_lines.reserve(lineSpans.size());
         std::size_t longestLineCharCount = 0;
         std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
+        for (const auto& lineSpan : lineSpans)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substr(searchPosStart));
+            m_lines.push_back(m_text.substr(lineSpan.start, lineSpan.length));
 
-            if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+            if ((m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                if (m_lines.back().length() > longestLineCharCount)
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    longestLineCharCount = m_lines.back().length();
+                    longestLineIndex = m_lines.size() - 1;
                 }
             }
-
-            searchPosStart = newLinePos + 1;
         }
 
-        if ((m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+        {
+            if (m_monospacedFontOptimizationEnabled)
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+            else if (m_fontCached)
+            {
+                // Not using optimization for monospaced font, so really calculate the width of every line.
+                // All lines are measured in a single call to the font.
+                const std::vector<StringView> lineViews(m_lines.begin(), m_lines.end());
+                std::vector<float> lineWidths(m_lines.size());
+                m_fontCached.measureRuns(lineViews.data(), lineViews.size(), m_textSizeCached, false, lineWidths.data());
+                m_maxLineWidth = std::max(0.f, *std::max_element(lineWidths.begin(), lineWidths.end()));
+            }
+        }
 
         // Check if we should try to keep our selection
         if (keepSelection)
@@ -1546,6 +1552,8 @@ namespace tgui
             m_horizontalScrollbar->setWidth(getInnerSize().x);
             m_horizontalScrollbar->setViewportSize(static_cast<unsigned int>(getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight()));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1678,6 +1686,8 @@ namespace tgui
             m_lastSelection.first = m_selStart;
             m_lastSelection.second = m_selEnd;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1714,6 +1724,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> TextArea::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_focused ? Optional<Duration>{getEditCursorBlinkRate()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1855,6 +1873,8 @@ namespace tgui
 
         if (m_verticalScrollbar->isShown())
             m_verticalScrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop()});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
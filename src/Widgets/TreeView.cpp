@@ -430,6 +430,7 @@ namespace tgui
             return false;
 
         node->text.setString(leafText);
+        invalidate();
         return true;
     }
 
@@ -800,6 +801,7 @@ namespace tgui
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -821,6 +823,7 @@ namespace tgui
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -955,6 +958,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
                 m_doubleClickNodeIndex = selectedIndex;
             }
         }
@@ -1086,6 +1090,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t TreeView::getHoverStateId() const
+    {
+        return (((Widget::getHoverStateId() * 31) + m_verticalScrollbar->getHoverStateId()) * 31) + m_horizontalScrollbar->getHoverStateId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::keyPressed(const Event::KeyEvent& event)
     {
         // Don't do anything when no item is selected
@@ -1367,6 +1378,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> TreeView::getTimeUntilNextUpdate() const
+    {
+        return combineTimeUntilNextUpdate(Widget::getTimeUntilNextUpdate(), m_animationTimeElapsed,
+                                          m_possibleDoubleClick ? Optional<Duration>{getDoubleClickTime()} : Optional<Duration>{});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent)
     {
         for (const auto& childNode : node->children)
@@ -1485,6 +1504,7 @@ namespace tgui
 
         m_verticalScrollbar->setPosition(getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop());
         m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1745,6 +1765,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)]->text.setColor(m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +67,17 @@ TEST_CASE("[Animation]")
             REQUIRE(!widget->isVisible());
         }
 
+        SECTION("Widget has to be updated while animation is running")
+        {
+            REQUIRE(!widget->getTimeUntilNextUpdate());
+            widget->showWithEffect(tgui::ShowEffectType::Fade, std::chrono::milliseconds(250));
+            REQUIRE(widget->getTimeUntilNextUpdate());
+            REQUIRE(*widget->getTimeUntilNextUpdate() == tgui::Duration{});
+
+            widget->updateTime(std::chrono::milliseconds(250));
+            REQUIRE(!widget->getTimeUntilNextUpdate());
+        }
+
         SECTION("Time can go past the animation end")
         {
             widget->showWithEffect(tgui::ShowEffectType::SlideFromLeft, std::chrono::milliseconds(250));
@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+// Benchmarks are hidden by default, they can be executed by passing "[benchmark]" to the tests executable
+
+TEST_CASE("[Benchmarks] Hit-testing", "[.][benchmark]")
+{
+    // The children are placed in a grid of small widgets, like a wall of instruments
+    for (const unsigned int childCount : {100u, 1000u, 5000u})
+    {
+        auto group = tgui::Group::create();
+        const auto columns = static_cast<unsigned int>(std::sqrt(static_cast<float>(childCount)));
+        for (unsigned int i = 0; i < childCount; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({18, 18});
+            widget->setPosition({static_cast<float>(i % columns) * 20, static_cast<float>(i / columns) * 20});
+            group->add(widget);
+        }
+
+        const float areaSize = static_cast<float>(columns) * 20;
+        const auto hitTest = [&]{
+            std::size_t hits = 0;
+            for (float y = 5; y < areaSize; y += areaSize / 10)
+            {
+                for (float x = 5; x < areaSize; x += areaSize / 10)
+                {
+                    if (group->getWidgetAtPos({x, y}, true))
+                        ++hits;
+                }
+            }
+            return hits;
+        };
+
+        BENCHMARK(std::to_string(childCount) + " children without spatial index")
+        {
+            return hitTest();
+        };
+
+        group->setSpatialIndexEnabled(true);
+        BENCHMARK(std::to_string(childCount) + " children with spatial index")
+        {
+            return hitTest();
+        };
+    }
+}
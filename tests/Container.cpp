@@ -24,6 +24,21 @@
 
 #include "Tests.hpp"
 
+namespace
+{
+    class DrawCountingWidget : public tgui::ClickableWidget
+    {
+    public:
+        void draw(tgui::BackendRenderTarget& target, tgui::RenderStates states) const override
+        {
+            ++drawCount;
+            ClickableWidget::draw(target, states);
+        }
+
+        mutable unsigned int drawCount = 0;
+    };
+}
+
 TEST_CASE("[Container]")
 {
     auto container = std::make_shared<GuiNull>();
@@ -404,6 +419,54 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("RenderCache")
+    {
+        REQUIRE(!widget2->isRenderCacheEnabled());
+        widget2->setRenderCacheEnabled(true);
+        REQUIRE(widget2->isRenderCacheEnabled());
+
+        auto panelCopy = tgui::Panel::copy(widget2);
+        REQUIRE(panelCopy->isRenderCacheEnabled());
+
+        widget2->setRenderCacheEnabled(false);
+        REQUIRE(!widget2->isRenderCacheEnabled());
+
+        tgui::BackendGui& gui{*globalGui};
+        gui.removeAllWidgets();
+
+        auto panel = tgui::Panel::create({100, 100});
+        panel->setRenderCacheEnabled(true);
+        gui.add(panel);
+
+        auto group = tgui::Group::create({80, 80});
+        panel->add(group);
+
+        auto child = std::make_shared<DrawCountingWidget>();
+        child->setSize({50, 50});
+        group->add(child);
+
+        gui.draw();
+        REQUIRE(child->drawCount == 1);
+
+        // The child isn't drawn again while the cached image is used, unless the backend can't render to a texture
+        gui.draw();
+        const bool cacheUsed = (child->drawCount == 1);
+
+        // The cached image has to be redrawn when a child changes after it was drawn, even when it is nested deeper
+        child->setSize({60, 60});
+        gui.draw();
+        REQUIRE(child->drawCount == (cacheUsed ? 2u : 3u));
+
+        child->invalidate();
+        gui.draw();
+        REQUIRE(child->drawCount == (cacheUsed ? 3u : 4u));
+
+        gui.draw();
+        REQUIRE(child->drawCount == (cacheUsed ? 3u : 5u));
+
+        gui.removeAllWidgets();
+    }
+
     SECTION("getWidgetAtPos / getWidgetBelowMouseCursor")
     {
         container->setAbsoluteView({-5, 40, 100, 400});
@@ -443,5 +506,213 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}, false) == w2);
     }
 
+    SECTION("Spatial index")
+    {
+        auto group = tgui::Group::create({600, 600});
+        REQUIRE(!group->isSpatialIndexEnabled());
+        group->setSpatialIndexEnabled(true);
+        REQUIRE(group->isSpatialIndexEnabled());
+
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            widgets.push_back(tgui::ClickableWidget::create({10, 10}));
+            widgets.back()->setPosition({static_cast<float>(i % 10) * 20, static_cast<float>(i / 10) * 20});
+            group->add(widgets.back());
+        }
+
+        REQUIRE(group->getWidgetAtPos({5, 5}, false) == widgets[0]);
+        REQUIRE(group->getWidgetAtPos({15, 5}, false) == nullptr);
+        REQUIRE(group->getWidgetAtPos({185, 185}, false) == widgets[99]);
+        REQUIRE(group->getWidgetAtPos({195, 195}, false) == nullptr);
+
+        // Moving a widget updates the index
+        widgets[0]->setPosition({22, 2});
+        REQUIRE(group->getWidgetAtPos({5, 5}, false) == nullptr);
+        REQUIRE(group->getWidgetAtPos({25, 5}, false) == widgets[1]);
+
+        // Changing the z-order updates the index
+        widgets[0]->moveToFront();
+        REQUIRE(group->getWidgetAtPos({25, 5}, false) == widgets[0]);
+
+        // Hidden widgets are skipped
+        widgets[0]->setVisible(false);
+        REQUIRE(group->getWidgetAtPos({25, 5}, false) == widgets[1]);
+        widgets[0]->setVisible(true);
+        REQUIRE(group->getWidgetAtPos({25, 5}, false) == widgets[0]);
+        widgets[0]->setVisible(false);
+
+        // Widgets can be moved outside the area that was covered by the index
+        widgets[1]->setPosition({500, 500});
+        REQUIRE(group->getWidgetAtPos({505, 505}, false) == widgets[1]);
+
+        // Resizing a widget updates the index
+        widgets[2]->setSize({100, 100});
+        REQUIRE(group->getWidgetAtPos({135, 95}, false) == widgets[2]);
+
+        // Removed widgets are no longer found
+        group->remove(widgets[2]);
+        REQUIRE(group->getWidgetAtPos({135, 95}, false) == nullptr);
+
+        // The origin, scale and rotation of the widgets are taken into account
+        widgets[3]->setOrigin({0.5f, 0.5f});
+        widgets[3]->setScale({4, 4});
+        REQUIRE(group->getWidgetAtPos({65, 15}, false) == widgets[3]);
+        REQUIRE(group->getWidgetAtPos({45, 15}, false) == widgets[3]);
+
+        // Changing the text of a check box changes the area that it reacts to
+        auto checkBox = tgui::CheckBox::create("A");
+        checkBox->setSize({20, 20});
+        checkBox->setPosition({300, 300});
+        group->add(checkBox);
+        REQUIRE(group->getWidgetAtPos({305, 310}, false) == checkBox);
+
+        const float shortTextRight = 300 + checkBox->getFullSize().x;
+        checkBox->setText("A much longer text");
+        const float longTextRight = 300 + checkBox->getFullSize().x;
+        REQUIRE(longTextRight > shortTextRight + 10);
+        REQUIRE(group->getWidgetAtPos({longTextRight - 5, 310}, false) == checkBox);
+    }
+
+    SECTION("Culling child widgets")
+    {
+        // Children are culled based on their cached bounds, which doesn't depend on damage tracking
+        tgui::BackendGui& gui{*globalGui};
+        gui.removeAllWidgets();
+        REQUIRE(!gui.isDamageTrackingEnabled());
+
+        auto panel = tgui::ScrollablePanel::create({100, 100});
+        gui.add(panel);
+
+        std::vector<std::shared_ptr<DrawCountingWidget>> widgets;
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            widgets.push_back(std::make_shared<DrawCountingWidget>());
+            widgets.back()->setSize({80, 20});
+            widgets.back()->setPosition({0, static_cast<float>(i) * 30});
+            panel->add(widgets.back());
+        }
+
+        gui.draw();
+        REQUIRE(widgets[0]->drawCount == 1);
+        REQUIRE(widgets[3]->drawCount == 1);
+        REQUIRE(widgets[4]->drawCount == 0);
+        REQUIRE(widgets[49]->drawCount == 0);
+
+        // Scrolling changes which widgets are visible
+        panel->getVerticalScrollbar()->setValue(300);
+        gui.draw();
+        REQUIRE(widgets[3]->drawCount == 1);
+        REQUIRE(widgets[10]->drawCount == 1);
+        REQUIRE(widgets[13]->drawCount == 1);
+        REQUIRE(widgets[14]->drawCount == 0);
+
+        // Widgets that are moved or resized into the visible area are drawn
+        widgets[49]->setPosition({0, 310});
+        widgets[8]->setSize({80, 100});
+        gui.draw();
+        REQUIRE(widgets[49]->drawCount == 1);
+        REQUIRE(widgets[8]->drawCount == 1);
+        REQUIRE(widgets[10]->drawCount == 2);
+        REQUIRE(widgets[20]->drawCount == 0);
+
+        gui.removeAllWidgets();
+    }
+
+    SECTION("Only widgets that requested time updates are updated")
+    {
+        class UpdateCountingWidget : public tgui::ClickableWidget
+        {
+        public:
+            bool updateTime(tgui::Duration elapsedTime) override
+            {
+                ++updateCount;
+                return ClickableWidget::updateTime(elapsedTime);
+            }
+
+            unsigned int updateCount = 0;
+        };
+
+        auto panel = tgui::Panel::create();
+        container->add(panel);
+
+        std::vector<std::shared_ptr<UpdateCountingWidget>> widgets;
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            widgets.push_back(std::make_shared<UpdateCountingWidget>());
+            panel->add(widgets.back());
+        }
+
+        // Widgets are updated once after being added, they aren't updated again when nothing changed
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(widgets[2]->updateCount == 1);
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(widgets[2]->updateCount == 1);
+
+        widgets[2]->moveWithAnimation({50, 50}, std::chrono::milliseconds(100));
+        container->updateTime(std::chrono::milliseconds(50));
+        REQUIRE(widgets[2]->updateCount == 2);
+        REQUIRE(widgets[3]->updateCount == 1);
+
+        // Hidden widgets are skipped until they become visible again
+        panel->setVisible(false);
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(widgets[2]->updateCount == 2);
+        panel->setVisible(true);
+
+        container->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widgets[2]->updateCount == 3);
+        REQUIRE(widgets[2]->getPosition() == tgui::Vector2f(50, 50));
+
+        // The widget is updated once more because it changed, after which it is no longer updated
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(widgets[2]->updateCount == 4);
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(widgets[2]->updateCount == 4);
+
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+        {
+            if (i != 2)
+                REQUIRE(widgets[i]->updateCount == 1);
+        }
+    }
+
+    SECTION("Widgets that only override updateTime are updated while they change")
+    {
+        class SelfAnimatingWidget : public tgui::ClickableWidget
+        {
+        public:
+            bool updateTime(tgui::Duration elapsedTime) override
+            {
+                ClickableWidget::updateTime(elapsedTime);
+                ++updateCount;
+                return (updateCount < 3);
+            }
+
+            unsigned int updateCount = 0;
+        };
+
+        auto panel = tgui::Panel::create();
+        container->add(panel);
+
+        auto widget = std::make_shared<SelfAnimatingWidget>();
+        panel->add(widget);
+
+        // The main loop doesn't wait for events while the widget still has to be updated
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(container->getTimeUntilNextUpdate());
+            REQUIRE(*container->getTimeUntilNextUpdate() == tgui::Duration{});
+            container->updateTime(std::chrono::milliseconds(10));
+        }
+
+        REQUIRE(!std::static_pointer_cast<tgui::Widget>(panel)->getTimeUntilNextUpdate());
+
+        for (unsigned int i = 0; i < 2; ++i)
+            container->updateTime(std::chrono::milliseconds(10));
+
+        REQUIRE(widget->updateCount == 3);
+    }
+
     // TODO: Events
 }
@@ -24,6 +24,14 @@
 
 #include "Tests.hpp"
 
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #if TGUI_BUILD_AS_CXX_MODULE
+        import tgui.backend.font.freetype;
+    #else
+        #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+    #endif
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -37,4 +45,164 @@ TEST_CASE("[Font]")
     REQUIRE(!font.isSmooth());
     font.setSmooth(true);
     REQUIRE(font.isSmooth());
+
+    SECTION("Advance")
+    {
+        for (const char32_t codePoint : {U'A', U'i', U' ', U'\u00e9', U'\u0416'})
+        {
+            REQUIRE(font.getAdvance(codePoint, 20, false) == font.getGlyph(codePoint, 20, false).advance);
+            REQUIRE(font.getAdvance(codePoint, 20, true) == font.getGlyph(codePoint, 20, true).advance);
+        }
+    }
+
+    SECTION("MeasureRuns")
+    {
+        const std::vector<tgui::String> strings = {U"AV", U"Te\tst\r", U"", U"First\nSecond"};
+        const std::vector<tgui::StringView> runs(strings.begin(), strings.end());
+        std::vector<float> widths(runs.size());
+        font.measureRuns(runs.data(), runs.size(), 20, false, widths.data());
+
+        REQUIRE(widths[0] == Approx(font.getAdvance(U'A', 20) + font.getAdvance(U'V', 20) + font.getKerning(U'A', U'V', 20)));
+        REQUIRE(widths[1] > 4 * font.getAdvance(U' ', 20));
+        REQUIRE(widths[2] == 0);
+        REQUIRE(widths[3] == Approx(tgui::Text::getLineWidth(U"First", font, 20)));
+    }
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    SECTION("DistanceField")
+    {
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(!backendFont->isDistanceFieldEnabled());
+
+        const float advance = backendFont->getGlyph(U'A', 20, false).advance;
+        backendFont->setDistanceFieldEnabled(true);
+        if (backendFont->isDistanceFieldEnabled()) // Requires FreeType 2.11 or newer
+        {
+            // The same glyph is used for all character sizes
+            const tgui::FontGlyph smallGlyph = backendFont->getGlyph(U'A', 10, false);
+            const tgui::FontGlyph largeGlyph = backendFont->getGlyph(U'A', 40, false);
+            REQUIRE(smallGlyph.textureRect == largeGlyph.textureRect);
+            REQUIRE(smallGlyph.page == largeGlyph.page);
+            REQUIRE(largeGlyph.bounds.width == Approx(4 * smallGlyph.bounds.width));
+
+            REQUIRE(backendFont->getGlyph(U'A', 20, false).advance == advance);
+
+            backendFont->setDistanceFieldEnabled(false);
+            REQUIRE(!backendFont->isDistanceFieldEnabled());
+            REQUIRE(backendFont->getGlyph(U'A', 10, false).textureRect != backendFont->getGlyph(U'A', 40, false).textureRect);
+        }
+    }
+
+    SECTION("Prewarm")
+    {
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        auto referenceFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(referenceFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        REQUIRE(!backendFont->isBackgroundRasterizationEnabled());
+        backendFont->setBackgroundRasterizationEnabled(true);
+        REQUIRE(backendFont->isBackgroundRasterizationEnabled());
+
+        // Glyphs that were rendered in the background are identical to glyphs that were loaded when they were needed
+        backendFont->prewarm({{U'A', U'Z'}, {U'\u0410', U'\u042F'}}, {12, 20}, {tgui::TextStyle::Regular, tgui::TextStyle::Bold});
+        for (const char32_t codePoint : {U'A', U'Q', U'\u0416'})
+        {
+            for (const bool bold : {false, true})
+            {
+                const tgui::FontGlyph glyph = backendFont->getGlyph(codePoint, 20, bold);
+                const tgui::FontGlyph referenceGlyph = referenceFont->getGlyph(codePoint, 20, bold);
+                REQUIRE(glyph.advance == referenceGlyph.advance);
+                REQUIRE(glyph.bounds == referenceGlyph.bounds);
+                REQUIRE(glyph.textureRect.getSize() == referenceGlyph.textureRect.getSize());
+            }
+        }
+
+        backendFont->setBackgroundRasterizationEnabled(false);
+        REQUIRE(!backendFont->isBackgroundRasterizationEnabled());
+        tgui::Font(backendFont, "").prewarm({{U'0', U'9'}}, {16});
+        REQUIRE(backendFont->getGlyph(U'5', 16, false).advance == referenceFont->getGlyph(U'5', 16, false).advance);
+    }
+
+    SECTION("AtlasMemoryLimit")
+    {
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        auto referenceFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(referenceFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        // With the lowest possible limit, only a single page is kept and it is cleared whenever it is full
+        backendFont->setAtlasMemoryLimit(1);
+        REQUIRE(backendFont->getAtlasMemoryLimit() == 1);
+
+        const tgui::Vector2u firstSize = backendFont->getGlyph(U'W', 100, false).textureRect.getSize();
+        std::size_t maxMemoryUsage = 0;
+        std::size_t totalGlyphArea = 0;
+        for (unsigned int characterSize = 100; characterSize < 300; characterSize += 4)
+        {
+            const tgui::FontGlyph glyph = backendFont->getGlyph(U'W', characterSize, false);
+            totalGlyphArea += static_cast<std::size_t>(glyph.textureRect.width) * glyph.textureRect.height;
+            maxMemoryUsage = std::max(maxMemoryUsage, backendFont->getAtlasMemoryUsage());
+            REQUIRE(backendFont->getPageCount() == 1);
+        }
+
+        // The glyphs wouldn't fit on the page together, so some of them have been evicted
+        REQUIRE(totalGlyphArea * 4 > maxMemoryUsage);
+        REQUIRE(backendFont->getAtlasMemoryUsage() == maxMemoryUsage);
+
+        // Evicted glyphs are rendered again when they are needed
+        const tgui::FontGlyph glyph = backendFont->getGlyph(U'W', 100, false);
+        const tgui::FontGlyph referenceGlyph = referenceFont->getGlyph(U'W', 100, false);
+        REQUIRE(glyph.textureRect.getSize() == firstSize);
+        REQUIRE(glyph.bounds == referenceGlyph.bounds);
+        REQUIRE(glyph.advance == referenceGlyph.advance);
+
+        // Measurements remain correct when many character sizes are used
+        for (unsigned int characterSize = 10; characterSize < 100; ++characterSize)
+            REQUIRE(backendFont->getAdvance(U'A', characterSize, false) == referenceFont->getAdvance(U'A', characterSize, false));
+        REQUIRE(backendFont->getKerning(U'A', U'V', 10, false) == referenceFont->getKerning(U'A', U'V', 10, false));
+    }
+
+    SECTION("GlyphCache")
+    {
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(!backendFont->saveGlyphCache("GlyphCache.bin"));
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        const tgui::FontGlyph glyph = backendFont->getGlyph(U'A', 20, false);
+        const float kerning = backendFont->getKerning(U'A', U'V', 20, false);
+        REQUIRE(backendFont->saveGlyphCache("GlyphCache.bin"));
+
+        auto cachedFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(cachedFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(!cachedFont->loadGlyphCache("NonExistentFile.bin"));
+        REQUIRE(!cachedFont->loadGlyphCache("resources/DejaVuSans.ttf"));
+        REQUIRE(cachedFont->loadGlyphCache("GlyphCache.bin"));
+
+        const tgui::FontGlyph cachedGlyph = cachedFont->getGlyph(U'A', 20, false);
+        REQUIRE(cachedGlyph.textureRect == glyph.textureRect);
+        REQUIRE(cachedGlyph.bounds == glyph.bounds);
+        REQUIRE(cachedGlyph.advance == glyph.advance);
+        REQUIRE(cachedFont->getKerning(U'A', U'V', 20, false) == kerning);
+
+        // Glyphs that weren't in the cache are still added to the atlas
+        REQUIRE(cachedFont->getGlyph(U'B', 20, false).textureRect.width > 0);
+
+        // A cache file can't be loaded when the font scale differs, as the stored metrics depend on it
+        auto scaledFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(scaledFont->loadFromFile("resources/DejaVuSans.ttf"));
+        scaledFont->setFontScale(2);
+        REQUIRE(!scaledFont->loadGlyphCache("GlyphCache.bin"));
+
+        // Pages that were restored from the cache don't grow beyond the maximum size when new glyphs are added
+        auto filledFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(filledFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(filledFont->loadGlyphCache("GlyphCache.bin"));
+        for (unsigned int characterSize = 20; characterSize < 400; characterSize += 2)
+            REQUIRE(filledFont->getGlyph(U'W', characterSize, false).textureRect.width > 0);
+        REQUIRE(filledFont->getPageCount() > 1);
+        for (unsigned int i = 1; i < filledFont->getPageCount(); ++i)
+            REQUIRE(filledFont->getPageTextureSize(20, i) == filledFont->getPageTextureSize(20, 0));
+    }
+#endif
 }
@@ -35,6 +35,7 @@
     #define WIN32_LEAN_AND_MEAN
 #endif
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include "catch.hpp"
 
 #include <memory>
@@ -137,5 +137,220 @@ TEST_CASE("[Text]")
             text3.setFont("resources/DejaVuSans.ttf");
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
+
+        SECTION("Identical texts with glyph run cache")
+        {
+            text.setString("Cancel");
+
+            tgui::Text text2;
+            text2.setCharacterSize(text.getCharacterSize());
+            text2.setFont(text.getFont());
+            text2.setString("Cancel");
+            REQUIRE(text.getSize() == text2.getSize());
+
+            text2.setColor(tgui::Color::Red);
+            REQUIRE(text.getSize() == text2.getSize());
+
+            // Changing the colors or the string of a text doesn't affect other texts that share the same vertices
+            const auto getVertices = [](const tgui::Text& t){
+                std::vector<tgui::Vertex> vertices;
+                for (const auto& pair : t.getBackendText()->getVertexData())
+                    vertices.insert(vertices.end(), pair.second->begin(), pair.second->end());
+                return vertices;
+            };
+            const auto requireSameVertices = [](const std::vector<tgui::Vertex>& vertices1, const std::vector<tgui::Vertex>& vertices2){
+                REQUIRE(vertices1.size() == vertices2.size());
+                for (std::size_t i = 0; i < vertices1.size(); ++i)
+                {
+                    REQUIRE(vertices1[i].position == vertices2[i].position);
+                    REQUIRE(vertices1[i].texCoords == vertices2[i].texCoords);
+                    REQUIRE(vertices1[i].color.red == vertices2[i].color.red);
+                    REQUIRE(vertices1[i].color.green == vertices2[i].color.green);
+                    REQUIRE(vertices1[i].color.blue == vertices2[i].color.blue);
+                    REQUIRE(vertices1[i].color.alpha == vertices2[i].color.alpha);
+                }
+            };
+
+            text2.setColor(text.getColor());
+            const tgui::Color color = text.getColor();
+            const std::vector<tgui::Vertex> vertices = getVertices(text);
+            REQUIRE(!vertices.empty());
+            requireSameVertices(getVertices(text2), vertices);
+
+            text2.setColor(tgui::Color::Red);
+            text2.setOutlineColor(tgui::Color::Blue);
+            REQUIRE(text.getColor() == color);
+            requireSameVertices(getVertices(text), vertices);
+            for (const auto& vertex : getVertices(text2))
+            {
+                REQUIRE(vertex.color.red == 255);
+                REQUIRE(vertex.color.green == 0);
+                REQUIRE(vertex.color.blue == 0);
+            }
+
+            text2.setString("Other");
+            REQUIRE(text.getString() == "Cancel");
+            REQUIRE(text.getColor() == color);
+            requireSameVertices(getVertices(text), vertices);
+
+            const std::size_t oldLimit = tgui::BackendText::getGlyphRunCacheMemoryLimit();
+            tgui::BackendText::setGlyphRunCacheMemoryLimit(0);
+            REQUIRE(tgui::BackendText::getGlyphRunCacheMemoryLimit() == 0);
+
+            tgui::Text text3;
+            text3.setCharacterSize(text.getCharacterSize());
+            text3.setFont(text.getFont());
+            text3.setString("Cancel");
+            REQUIRE(text.getSize() == text3.getSize());
+
+            tgui::BackendText::setGlyphRunCacheMemoryLimit(oldLimit);
+        }
+    }
+
+    SECTION("BackendText recoloring")
+    {
+        tgui::BackendText::clearGlyphRunCache();
+
+        const auto createText = [](const tgui::Color& fillColor, const tgui::Color& outlineColor){
+            auto backendText = std::make_unique<tgui::BackendText>();
+            backendText->setFont(tgui::Font::getGlobalFont().getBackendFont());
+            backendText->setCharacterSize(20);
+            backendText->setOutlineThickness(1);
+            backendText->setFillColor(fillColor);
+            backendText->setOutlineColor(outlineColor);
+            backendText->setString("OK");
+            return backendText;
+        };
+
+        // Returns the vertices of the first page, either of the text itself or of its outline
+        const auto getVertices = [](tgui::BackendText& backendText, bool outline){
+            const auto vertexData = backendText.getVertexData(outline, !outline);
+            REQUIRE(!vertexData.empty());
+            REQUIRE(!vertexData[0].second->empty());
+            return vertexData[0].second;
+        };
+
+        const auto requireColor = [](const std::vector<tgui::Vertex>& vertices, const tgui::Color& color){
+            for (const auto& vertex : vertices)
+            {
+                REQUIRE(vertex.color.red == color.getRed());
+                REQUIRE(vertex.color.green == color.getGreen());
+                REQUIRE(vertex.color.blue == color.getBlue());
+                REQUIRE(vertex.color.alpha == color.getAlpha());
+            }
+        };
+
+        auto whiteText = createText(tgui::Color::White, tgui::Color::Black);
+        auto redText = createText(tgui::Color::Red, tgui::Color::Black);
+        auto greenOutlineText = createText(tgui::Color::White, tgui::Color::Green);
+        const auto whiteVertices = getVertices(*whiteText, false);
+        const auto redVertices = getVertices(*redText, false);
+        const auto greenOutlineVertices = getVertices(*greenOutlineText, true);
+
+        // A text with the same properties shares the vertices from the glyph run cache
+        auto text2 = createText(tgui::Color::White, tgui::Color::Black);
+        REQUIRE(getVertices(*text2, false) == whiteVertices);
+
+        // Recoloring reuses the cached vertices of another text that already has the new color
+        text2->setFillColor(tgui::Color::Red);
+        REQUIRE(getVertices(*text2, false) == redVertices);
+        requireColor(*redVertices, tgui::Color::Red);
+        requireColor(*getVertices(*whiteText, false), tgui::Color::White);
+
+        text2->setFillColor(tgui::Color::White);
+        text2->setOutlineColor(tgui::Color::Green);
+        REQUIRE(getVertices(*text2, true) == greenOutlineVertices);
+        requireColor(*greenOutlineVertices, tgui::Color::Green);
+        requireColor(*getVertices(*whiteText, true), tgui::Color::Black);
+
+        // Without cached vertices in the new color, the shared vertices are copied before being recolored
+        text2->setFillColor(tgui::Color::Blue);
+        const auto blueVertices = getVertices(*text2, false);
+        REQUIRE(blueVertices != whiteVertices);
+        REQUIRE(blueVertices != redVertices);
+        REQUIRE(blueVertices->size() == whiteVertices->size());
+        requireColor(*blueVertices, tgui::Color::Blue);
+        requireColor(*whiteVertices, tgui::Color::White);
+        requireColor(*redVertices, tgui::Color::Red);
+        requireColor(*getVertices(*greenOutlineText, false), tgui::Color::White);
+
+        text2->setOutlineColor(tgui::Color::Yellow);
+        requireColor(*getVertices(*text2, true), tgui::Color::Yellow);
+        requireColor(*greenOutlineVertices, tgui::Color::Green);
+        requireColor(*getVertices(*whiteText, true), tgui::Color::Black);
+
+        // Vertices that are no longer shared are recolored in place
+        text2->setFillColor(tgui::Color::Magenta);
+        REQUIRE(getVertices(*text2, false) == blueVertices);
+        requireColor(*blueVertices, tgui::Color::Magenta);
+    }
+
+    SECTION("WordWrap")
+    {
+        const tgui::Font font = tgui::Font::getGlobalFont();
+        const unsigned int textSize = 20;
+
+        const tgui::String str = "word word word\n\nword";
+        const float maxWidth = tgui::Text::getLineWidth("word word", font, textSize) + 1;
+        REQUIRE(tgui::Text::wordWrap(maxWidth, str, font, textSize, false) == "word word \nword\n\nword");
+
+        auto lines = tgui::Text::wordWrapSpans(maxWidth, str, font, textSize, false);
+        REQUIRE(lines.size() == 4);
+        REQUIRE(str.substr(lines[0].start, lines[0].length) == "word word ");
+        REQUIRE(str.substr(lines[1].start, lines[1].length) == "word");
+        REQUIRE(lines[2].length == 0);
+        REQUIRE(str.substr(lines[3].start, lines[3].length) == "word");
+
+        // Words that don't fit on a line are split
+        const float charWidth = tgui::Text::getLineWidth("w", font, textSize);
+        lines = tgui::Text::wordWrapSpans(charWidth * 2.5f, "wwwww", font, textSize, false);
+        REQUIRE(lines.size() == 3);
+        REQUIRE(lines[0].length == 2);
+        REQUIRE(lines[1].length == 2);
+        REQUIRE(lines[2].length == 1);
+
+        // Without a maximum width, the text is only split on newlines
+        lines = tgui::Text::wordWrapSpans(0, str, font, textSize, false);
+        REQUIRE(lines.size() == 3);
+        REQUIRE(str.substr(lines[0].start, lines[0].length) == "word word word");
+
+        REQUIRE(tgui::Text::wordWrapSpans(maxWidth, "", font, textSize, false).size() == 1);
+        REQUIRE(tgui::Text::wordWrap(maxWidth, "", font, textSize, false) == "");
+
+        SECTION("Cache")
+        {
+            // Wrapping at a slightly different width reuses the cached breaks, the result remains the same
+            REQUIRE(tgui::Text::wordWrap(maxWidth + 1, str, font, textSize, false) == "word word \nword\n\nword");
+            REQUIRE(tgui::Text::wordWrap(maxWidth * 2, str, font, textSize, false) == "word word word\n\nword");
+
+            const std::size_t oldLimit = tgui::Text::getWordWrapCacheMemoryLimit();
+            tgui::Text::setWordWrapCacheMemoryLimit(0);
+            REQUIRE(tgui::Text::getWordWrapCacheMemoryLimit() == 0);
+            REQUIRE(tgui::Text::wordWrap(maxWidth, str, font, textSize, false) == "word word \nword\n\nword");
+
+            tgui::Text::setWordWrapCacheMemoryLimit(oldLimit);
+            tgui::Text::clearWordWrapCache();
+            REQUIRE(tgui::Text::wordWrap(maxWidth, str, font, textSize, false) == "word word \nword\n\nword");
+
+            // Cached breaks aren't reused when the font scale changes or when the font is loaded again
+            const tgui::Font otherFont("resources/DejaVuSans.ttf");
+            const auto backendFont = otherFont.getBackendFont();
+            const float exactWidth = tgui::Text::getLineWidth("word word", otherFont, textSize);
+            (void)tgui::Text::wordWrap(exactWidth, str, otherFont, textSize, false);
+
+            const unsigned int metricsVersion = backendFont->getMetricsVersion();
+            backendFont->setFontScale(1.5f);
+            REQUIRE(backendFont->getMetricsVersion() != metricsVersion);
+            const tgui::String scaledResult = tgui::Text::wordWrap(exactWidth, str, otherFont, textSize, false);
+
+            tgui::Text::setWordWrapCacheMemoryLimit(0);
+            REQUIRE(tgui::Text::wordWrap(exactWidth, str, otherFont, textSize, false) == scaledResult);
+            tgui::Text::setWordWrapCacheMemoryLimit(oldLimit);
+
+            const unsigned int scaledMetricsVersion = backendFont->getMetricsVersion();
+            REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+            REQUIRE(backendFont->getMetricsVersion() != scaledMetricsVersion);
+            backendFont->setFontScale(1);
+        }
     }
 }
@@ -241,6 +241,28 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("UpdateRegion")
+    {
+        auto backendTexture = tgui::getBackend()->getRenderer()->createTexture();
+        auto pixels = std::make_unique<std::uint8_t[]>(4 * 4 * 4);
+        REQUIRE(backendTexture->load({4, 4}, std::move(pixels), false));
+
+        const std::uint8_t regionPixels[2 * 2 * 4] = {
+            1, 2, 3, 4,     5, 6, 7, 8,
+            9, 10, 11, 12,  13, 14, 15, 16
+        };
+        REQUIRE(backendTexture->updateRegion({1, 2, 2, 2}, regionPixels));
+
+        // The stored pixels are updated as well
+        const std::uint8_t* storedPixels = backendTexture->getPixels();
+        REQUIRE(storedPixels[((2 * 4) + 1) * 4] == 1);
+        REQUIRE(storedPixels[((2 * 4) + 2) * 4 + 3] == 8);
+        REQUIRE(storedPixels[((3 * 4) + 1) * 4 + 1] == 10);
+        REQUIRE(storedPixels[((3 * 4) + 2) * 4 + 2] == 15);
+        REQUIRE(storedPixels[((1 * 4) + 1) * 4] == 0);
+        REQUIRE(storedPixels[((3 * 4) + 3) * 4] == 0);
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
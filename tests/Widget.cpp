@@ -105,6 +105,86 @@ TEST_CASE("[Widget]")
         REQUIRE(panel->getParentGui() == nullptr);
     }
 
+    SECTION("Invalidate")
+    {
+        tgui::BackendGui& gui{*globalGui};
+        gui.removeAllWidgets();
+        gui.add(widget);
+
+        REQUIRE(!gui.isDamageTrackingEnabled());
+        REQUIRE(gui.isRedrawRequired());
+
+        gui.setDamageTrackingEnabled(true);
+        REQUIRE(gui.isDamageTrackingEnabled());
+        REQUIRE(gui.isRedrawRequired());
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        widget->setPosition(10, 20);
+        REQUIRE(gui.isRedrawRequired());
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        widget->invalidate();
+        REQUIRE(gui.isRedrawRequired());
+
+        // Both the old and the new area have to be damaged when a widget moves after its transform was used
+        widget->setSize(30, 40);
+        gui.draw();
+        widget->invalidate();
+        gui.draw();
+        widget->setPosition(100, 120);
+        const tgui::FloatRect region = gui.getDamagedRegion();
+        REQUIRE(region.left <= 10);
+        REQUIRE(region.top <= 20);
+        REQUIRE(region.left + region.width >= 130);
+        REQUIRE(region.top + region.height >= 160);
+
+        // Changing the contents of a widget only damages the area of that widget
+        auto label = tgui::Label::create("Text");
+        label->setPosition(300, 200);
+        gui.add(label);
+        gui.draw();
+        label->setText("Other text");
+        REQUIRE(gui.isRedrawRequired());
+        const tgui::FloatRect labelRegion = gui.getDamagedRegion();
+        REQUIRE(labelRegion.left >= 290);
+        REQUIRE(labelRegion.top >= 190);
+
+        // Moving the mouse over a widget only damages it when the part below the mouse changes
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = 305;
+        event.mouseMove.y = 205;
+        gui.handleEvent(event);
+        gui.draw();
+        event.mouseMove.x = 310;
+        gui.handleEvent(event);
+        REQUIRE(!gui.isRedrawRequired());
+
+        // Signal handlers don't cause the entire gui to be redrawn
+        label->onClick([]{});
+        label->onClick.emit(label.get(), tgui::Vector2f{});
+        REQUIRE(!gui.isRedrawRequired());
+
+        // Setting the transform to the value it already has doesn't cause a redraw
+        label->setOrigin(0.5f, 0.5f);
+        label->setScale({2, 2});
+        label->setRotation(45);
+        gui.draw();
+        label->setOrigin(0.5f, 0.5f);
+        label->setScale({2, 2});
+        label->setRotation(45);
+        REQUIRE(!gui.isRedrawRequired());
+        label->setRotation(45, {0, 0});
+        REQUIRE(gui.isRedrawRequired());
+
+        gui.setDamageTrackingEnabled(false);
+        gui.removeAllWidgets();
+    }
+
     SECTION("MouseCursor")
     {
         REQUIRE(widget->getMouseCursor() == tgui::Cursor::Type::Arrow);
@@ -305,6 +385,47 @@ TEST_CASE("[Widget]")
         REQUIRE(widget->getRotationOrigin() == tgui::Vector2f(0.8f, 0.7f));
     }
 
+    SECTION("Transform")
+    {
+        widget->setPosition(40, 30);
+        widget->setSize(100, 50);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(40, 30));
+        REQUIRE(widget->getAbsoluteTransform().transformPoint({10, 10}) == tgui::Vector2f(50, 40));
+
+        // The cached transforms are updated when the widget changes
+        widget->setOrigin(0.5f, 0.5f);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(-10, 5));
+        widget->setScale(2);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(-60, -20));
+        REQUIRE(widget->getAbsoluteBounds() == tgui::FloatRect(-60, -20, 200, 100));
+        widget->setScale(1);
+        widget->setOrigin(0, 0);
+
+        // The absolute transform is updated when a parent changes
+        auto panel = tgui::Panel::create({300, 200});
+        panel->setPosition(100, 200);
+        panel->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(140, 230));
+        REQUIRE(widget->getAbsoluteBounds() == tgui::FloatRect(140, 230, 100, 50));
+
+        panel->setPosition(200, 100);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(240, 130));
+
+        panel->getRenderer()->setBorders(5);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(245, 135));
+
+        auto scrollablePanel = tgui::ScrollablePanel::create({100, 100}, {500, 500});
+        scrollablePanel->setPosition(10, 20);
+        scrollablePanel->add(panel);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(255, 155));
+
+        scrollablePanel->getVerticalScrollbar()->setValue(50);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(255, 105));
+
+        scrollablePanel->remove(panel);
+        REQUIRE(widget->getAbsolutePosition() == tgui::Vector2f(245, 135));
+    }
+
     SECTION("TextSize")
     {
         widget->setTextSize(15);
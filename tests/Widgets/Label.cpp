@@ -184,6 +184,26 @@ TEST_CASE("[Label]")
             REQUIRE(doubleClickedCount == 1);
         }
 
+        SECTION("Time until double click expires")
+        {
+            label->setPosition(40, 30);
+            label->setSize(150, 100);
+
+            tgui::Widget::Ptr widget = label;
+            REQUIRE(!widget->getTimeUntilNextUpdate());
+
+            label->leftMousePressed({115, 80});
+            label->leftMouseReleased({115, 80});
+            REQUIRE(widget->getTimeUntilNextUpdate());
+            REQUIRE(*widget->getTimeUntilNextUpdate() == DOUBLE_CLICK_TIMEOUT);
+
+            widget->updateTime(DOUBLE_CLICK_TIMEOUT / 5);
+            REQUIRE(*widget->getTimeUntilNextUpdate() == DOUBLE_CLICK_TIMEOUT * 4 / 5);
+
+            widget->updateTime(DOUBLE_CLICK_TIMEOUT);
+            REQUIRE(!widget->getTimeUntilNextUpdate());
+        }
+
         SECTION("Mouse events pass through label with IgnoreMouseEvents=true")
         {
             unsigned int mousePressedCountBack = 0;